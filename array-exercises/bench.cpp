@@ -0,0 +1,48 @@
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include "ordenamiento_externo.h"
+
+using namespace std;
+
+/**
+ * Benchmark del ordenamiento externo: mide el rendimiento (MB/s) según el
+ * tamaño del archivo de entrada y el presupuesto de memoria.
+ */
+int main() {
+
+    const size_t MiB = 1024 * 1024;
+    size_t tamanios[] = { 16 * MiB, 64 * MiB, 256 * MiB };
+    size_t presupuestos[] = { 1 * MiB, 8 * MiB, 32 * MiB };
+
+    cout << "Entrada (MiB)\tPresupuesto (MiB)\tCorridas\tPasadas\tMB/s" << endl;
+    for (size_t tamanio : tamanios) {
+        // Generando el archivo de entrada con valores aleatorios
+        string entrada = (filesystem::temp_directory_path() / "bench_entrada.bin").string();
+        string salida = (filesystem::temp_directory_path() / "bench_salida.bin").string();
+        {
+            mt19937_64 generador(7);
+            vector<uint64_t> bloque(MiB / sizeof(uint64_t));
+            ofstream archivo(entrada, ios::binary | ios::trunc);
+            for (size_t escrito = 0; escrito < tamanio; escrito += MiB) {
+                for (uint64_t &valor : bloque) valor = generador();
+                archivo.write(reinterpret_cast<const char *>(bloque.data()), MiB);
+            }
+        }
+
+        for (size_t presupuesto : presupuestos) {
+            auto inicio = chrono::steady_clock::now();
+            ResultadoOrdenamiento r = ordenarArchivo<uint64_t>(entrada, salida, presupuesto);
+            chrono::duration<double> segundos = chrono::steady_clock::now() - inicio;
+            cout << tamanio / MiB << "\t\t" << presupuesto / MiB << "\t\t\t" << r.corridas << "\t\t"
+                 << r.pasadasMezcla << "\t" << (tamanio / 1e6) / segundos.count() << endl;
+        }
+
+        filesystem::remove(entrada);
+        filesystem::remove(salida);
+    }
+
+    return 0;
+}
@@ -1,5 +1,15 @@
 #include <iostream>
 #include <cmath>
+#include <fstream>
+#include <random>
+/**
+ * Ordenamiento externo para archivos más grandes que la memoria.
+ */
+#include "ordenamiento_externo.h"
+/**
+ * Vistas multidimensionales sin copia (definidas junto a los punteros).
+ */
+#include "../pointers/vistas.h"
 
 using namespace std;
 
@@ -16,6 +26,7 @@ int main() {
     cout << "(2) Extraer el menor valor de un arreglo" << endl;
     cout << "(3) Ordenar un arreglo por bubble sort (On^2)" << endl;
     cout << "(4) Producto de dos matrices (arreglos bidimensionales)" << endl;
+    cout << "(5) Ordenar un archivo más grande que la memoria (ordenamiento externo)" << endl;
 
     cout << endl;
     cin >> option;
@@ -135,18 +146,61 @@ int main() {
                 }
             }
 
+            /**
+             * Los valores se capturaron como a[columna][fila], así que el arreglo
+             * está guardado por columnas. En lugar de copiarlo a otro arreglo
+             * con el orden correcto, una vista por columnas lo lee tal cual.
+             */
+            Vista<_int, Extensiones<max, max>, DisposicionColumnas> matrizA(&a[0][0]), matrizB(&b[0][0]);
+            _int c[max][max];
+            Vista<_int, Extensiones<max, max>> producto(&c[0][0]);
+            multiplicar(matrizA, matrizB, producto);
+
             cout << endl << "Producto resultante:" << endl;
             for (_int i = 0; i < max; i++) {
                 for (_int j = 0; j < max; j++) {
-                    _int result = 0;
-                    for (_int k = 0; k < max; k++) {
-                        result = result + a[i][k] * b[k][j];
-                    }
-                    cout << result << " ";
+                    cout << producto(i, j) << " ";
                     if (j == (max - 1)) cout << endl;
                 }
             }
-            
+
+        }
+        break;
+        case 5: {
+            /**
+             * Ordenar un archivo más grande que la memoria (ordenamiento externo).
+             *
+             * El bubble sort anterior necesita que los 10 valores quepan en un
+             * arreglo. Aquí se genera un archivo binario con valores aleatorios y
+             * se ordena usando solo el presupuesto de memoria indicado.
+             */
+            unsigned long cantidad, presupuestoKiB;
+            cout << "Cantidad de valores a generar: ";
+            cin >> cantidad;
+            cout << "Presupuesto de memoria (KiB): ";
+            cin >> presupuestoKiB;
+
+            mt19937_64 generador(42);
+            {
+                ofstream archivo("valores.bin", ios::binary | ios::trunc);
+                for (unsigned long i = 0; i < cantidad; i++) {
+                    uint64_t valor = generador();
+                    archivo.write(reinterpret_cast<const char *>(&valor), sizeof(valor));
+                }
+            }
+
+            ResultadoOrdenamiento r = ordenarArchivo<uint64_t>("valores.bin", "valores_ordenados.bin", presupuestoKiB * 1024);
+            cout << "Registros: " << r.registros << ", corridas: " << r.corridas << ", pasadas de mezcla: " << r.pasadasMezcla << endl;
+
+            // Comprobando que el archivo resultante quedó ordenado
+            ifstream ordenado("valores_ordenados.bin", ios::binary);
+            uint64_t anterior = 0, valor;
+            bool correcto = true;
+            while (ordenado.read(reinterpret_cast<char *>(&valor), sizeof(valor))) {
+                if (valor < anterior) correcto = false;
+                anterior = valor;
+            }
+            cout << "Archivo ordenado correctamente: " << (correcto ? "sí" : "no") << endl;
         }
         break;
     }
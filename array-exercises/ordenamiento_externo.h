@@ -0,0 +1,415 @@
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Ordenamiento externo (external merge sort).
+ *
+ * Cuando el archivo a ordenar es mucho más grande que la memoria disponible,
+ * no es posible cargarlo completo en un arreglo como en el bubble sort de
+ * index.cpp. La solución clásica se divide en dos fases:
+ *
+ *   1. Generación de corridas: se leen bloques que caben en el presupuesto de
+ *      memoria, se ordenan en RAM y se escriben a archivos temporales.
+ *   2. Mezcla k-way: se abren todas las corridas a la vez y se mezclan con un
+ *      árbol de perdedores (loser tree), que elige el menor de k elementos con
+ *      log2(k) comparaciones.
+ *
+ * Los registros se leen y escriben en binario, por lo que el tipo T debe ser
+ * trivialmente copiable (int, double, structs sin punteros, etc.).
+ */
+#ifndef ORDENAMIENTO_EXTERNO_H
+#define ORDENAMIENTO_EXTERNO_H
+
+/**
+ * Hilo de E/S que vive lo mismo que el lector o escritor que lo usa. Lanzar un
+ * std::async por cada buffer crearía y destruiría un hilo en cada recarga;
+ * aquí el mismo hilo atiende todas las tareas, una a la vez. Una excepción
+ * dentro de la tarea se relanza en esperar(), en el hilo que la encargó.
+ */
+class HiloES {
+    public:
+        HiloES() : hilo(&HiloES::atender, this) {}
+        ~HiloES() {
+            {
+                lock_guard<mutex> candado(this->candado);
+                this->terminar = true;
+            }
+            this->aviso.notify_all();
+            this->hilo.join();
+        }
+        HiloES(const HiloES &) = delete;
+        HiloES &operator=(const HiloES &) = delete;
+
+        // Solo puede haber una tarea a la vez: hay que esperar() la anterior
+        void encargar(function<void()> tarea) {
+            {
+                lock_guard<mutex> candado(this->candado);
+                this->tarea = move(tarea);
+            }
+            this->aviso.notify_all();
+        }
+        void esperar() {
+            unique_lock<mutex> candado(this->candado);
+            this->aviso.wait(candado, [this]() { return !this->tarea; });
+            if (this->error) rethrow_exception(exchange(this->error, nullptr));
+        }
+    private:
+        mutex candado;
+        condition_variable aviso;
+        function<void()> tarea;
+        exception_ptr error;
+        bool terminar = false;
+        // Al final: el hilo arranca cuando lo demás ya está construido
+        thread hilo;
+
+        void atender() {
+            unique_lock<mutex> candado(this->candado);
+            while (true) {
+                this->aviso.wait(candado, [this]() { return this->tarea || this->terminar; });
+                // Una tarea pendiente se completa aunque se pida terminar
+                if (!this->tarea) return;
+                function<void()> &tarea = this->tarea;
+                candado.unlock();
+                exception_ptr error;
+                try {
+                    tarea();
+                } catch (...) {
+                    error = current_exception();
+                }
+                candado.lock();
+                this->error = error;
+                this->tarea = nullptr;
+                this->aviso.notify_all();
+            }
+        }
+};
+
+/**
+ * Lector secuencial con doble buffer. Mientras el programa consume un buffer,
+ * el siguiente se está llenando en el hilo de E/S, de forma que la lectura
+ * del disco se solapa con las comparaciones de la mezcla.
+ */
+template <typename T>
+class LectorCorrida {
+    public:
+        LectorCorrida(const string &ruta, size_t capacidad) : archivo(ruta, ios::binary), ruta(ruta) {
+            if (!archivo.is_open()) {
+                throw runtime_error("No se pudo abrir la corrida " + ruta);
+            }
+            this->capacidad = max<size_t>(capacidad, 1);
+            this->frente.resize(this->capacidad);
+            this->fondo.resize(this->capacidad);
+            this->es.encargar([this]() { this->llenar(); });
+            this->recargar();
+        }
+        bool agotado() const {
+            return posicion >= cantidad;
+        }
+        const T &actual() const {
+            return frente[posicion];
+        }
+        void avanzar() {
+            if (++posicion >= cantidad && !finArchivo) this->recargar();
+        }
+    private:
+        ifstream archivo;
+        string ruta;
+        size_t capacidad;
+        vector<T> frente, fondo;
+        size_t posicion = 0, cantidad = 0, cantidadFondo = 0;
+        bool finArchivo = false;
+        // Al final: se destruye (y espera a su tarea) antes que los buffers
+        HiloES es;
+
+        // Corre en el hilo de E/S
+        void llenar() {
+            archivo.read(reinterpret_cast<char *>(fondo.data()), capacidad * sizeof(T));
+            if (archivo.bad()) throw runtime_error("Error al leer la corrida " + ruta);
+            size_t bytes = static_cast<size_t>(archivo.gcount());
+            if (bytes % sizeof(T) != 0) throw runtime_error("La corrida " + ruta + " termina con un registro incompleto");
+            cantidadFondo = bytes / sizeof(T);
+        }
+        void recargar() {
+            // Esperando el buffer que se estaba leyendo y encargando la siguiente lectura
+            es.esperar();
+            cantidad = cantidadFondo;
+            posicion = 0;
+            frente.swap(fondo);
+            if (cantidad < capacidad) {
+                finArchivo = true;
+            } else {
+                es.encargar([this]() { this->llenar(); });
+            }
+        }
+};
+
+/**
+ * Escritor secuencial con doble buffer: cuando un buffer se llena se manda a
+ * escribir al hilo de E/S y se continúa llenando el otro.
+ *
+ * Los errores de escritura se lanzan en escribir() o en cerrar(). El
+ * destructor no puede lanzarlos, así que hay que llamar a cerrar() para
+ * enterarse de un disco lleno en el último buffer.
+ */
+template <typename T>
+class EscritorBuffer {
+    public:
+        EscritorBuffer(const string &ruta, size_t capacidad) : archivo(ruta, ios::binary | ios::trunc), ruta(ruta) {
+            if (!archivo.is_open()) {
+                throw runtime_error("No se pudo crear el archivo " + ruta);
+            }
+            this->capacidad = max<size_t>(capacidad, 1);
+            this->frente.reserve(this->capacidad);
+            this->fondo.reserve(this->capacidad);
+        }
+        ~EscritorBuffer() {
+            try {
+                this->cerrar();
+            } catch (...) {
+                // Ya se está saliendo por otro error, o no se llamó a cerrar()
+            }
+        }
+        void escribir(const T &valor) {
+            frente.push_back(valor);
+            if (frente.size() == capacidad) this->vaciar();
+        }
+        void escribir(const T *datos, size_t n) {
+            for (size_t i = 0; i < n; i++) this->escribir(datos[i]);
+        }
+        void cerrar() {
+            if (!archivo.is_open()) return;
+            this->vaciar();
+            es.esperar();
+            archivo.close();
+            if (!archivo) throw runtime_error("Error al cerrar el archivo " + ruta);
+        }
+    private:
+        ofstream archivo;
+        string ruta;
+        size_t capacidad;
+        vector<T> frente, fondo;
+        HiloES es;
+
+        void vaciar() {
+            es.esperar();
+            frente.swap(fondo);
+            frente.clear();
+            if (fondo.empty()) return;
+            es.encargar([this]() {
+                archivo.write(reinterpret_cast<const char *>(fondo.data()), fondo.size() * sizeof(T));
+                if (!archivo) throw runtime_error("Error al escribir el archivo " + ruta);
+            });
+        }
+};
+
+/**
+ * Árbol de perdedores para mezclar k corridas.
+ *
+ * Las hojas (k..2k-1) representan a cada corrida y los nodos internos (1..k-1)
+ * guardan al "perdedor" de la comparación en ese punto. El nodo 0 guarda al
+ * ganador global. Al avanzar la corrida ganadora solo hace falta recorrer el
+ * camino de su hoja hacia la raíz, comparando contra los perdedores guardados.
+ */
+template <typename T, typename Comparador = less<T>>
+class ArbolPerdedores {
+    public:
+        ArbolPerdedores(vector<LectorCorrida<T> *> corridas, Comparador cmp = Comparador()) {
+            this->corridas = corridas;
+            this->cmp = cmp;
+            this->k = corridas.size();
+            this->nodos.assign(max<size_t>(k, 1), 0);
+            if (k > 0) nodos[0] = this->construir(1);
+        }
+        bool vacio() const {
+            return k == 0 || corridas[nodos[0]]->agotado();
+        }
+        const T &minimo() const {
+            return corridas[nodos[0]]->actual();
+        }
+        void avanzar() {
+            size_t ganador = nodos[0];
+            corridas[ganador]->avanzar();
+            for (size_t nodo = (ganador + k) / 2; nodo >= 1; nodo /= 2) {
+                if (this->gana(nodos[nodo], ganador)) swap(nodos[nodo], ganador);
+            }
+            nodos[0] = ganador;
+        }
+    private:
+        vector<LectorCorrida<T> *> corridas;
+        vector<size_t> nodos;
+        size_t k;
+        Comparador cmp;
+
+        // Una corrida agotada se comporta como +infinito
+        bool gana(size_t a, size_t b) const {
+            if (corridas[a]->agotado()) return false;
+            if (corridas[b]->agotado()) return true;
+            return cmp(corridas[a]->actual(), corridas[b]->actual());
+        }
+        size_t construir(size_t nodo) {
+            if (nodo >= k) return nodo - k;
+            size_t izquierdo = this->construir(2 * nodo);
+            size_t derecho = this->construir(2 * nodo + 1);
+            if (this->gana(izquierdo, derecho)) {
+                nodos[nodo] = derecho;
+                return izquierdo;
+            }
+            nodos[nodo] = izquierdo;
+            return derecho;
+        }
+};
+
+// Resumen de una ejecución del ordenamiento externo
+struct ResultadoOrdenamiento {
+    size_t registros = 0;
+    size_t corridas = 0;
+    size_t pasadasMezcla = 0;
+};
+
+/**
+ * Corridas temporales de una ejecución. El destructor borra las que sigan en
+ * disco, así que una excepción a media mezcla no las deja tiradas en el
+ * directorio temporal.
+ */
+class ArchivosTemporales {
+    public:
+        ArchivosTemporales(const string &directorio) {
+            // Prefijo único para los archivos temporales de esta ejecución
+            random_device semilla;
+            this->prefijo = (filesystem::path(directorio) / ("corrida_" + to_string(semilla()) + "_")).string();
+        }
+        ~ArchivosTemporales() {
+            error_code ignorado;
+            for (const string &ruta : this->rutas) filesystem::remove(ruta, ignorado);
+        }
+        ArchivosTemporales(const ArchivosTemporales &) = delete;
+        ArchivosTemporales &operator=(const ArchivosTemporales &) = delete;
+
+        string nueva() {
+            this->rutas.push_back(this->prefijo + to_string(this->rutas.size()) + ".bin");
+            return this->rutas.back();
+        }
+    private:
+        string prefijo;
+        vector<string> rutas;
+};
+
+/**
+ * Ordena el archivo binario 'entrada' y escribe el resultado en 'salida' sin
+ * usar (aproximadamente) más de 'presupuesto' bytes de memoria para datos.
+ *
+ * Si hay demasiadas corridas para mezclarlas de una vez sin que los buffers
+ * queden demasiado pequeños, la mezcla se hace en varias pasadas.
+ *
+ * Lanza runtime_error si falla una lectura o escritura, o si el tamaño de
+ * 'entrada' no es múltiplo de sizeof(T) (el último registro está incompleto).
+ */
+template <typename T, typename Comparador = less<T>>
+ResultadoOrdenamiento ordenarArchivo(
+    const string &entrada,
+    const string &salida,
+    size_t presupuesto,
+    Comparador cmp = Comparador(),
+    const string &directorioTemporal = filesystem::temp_directory_path().string()
+) {
+    static_assert(is_trivially_copyable<T>::value, "T debe ser trivialmente copiable");
+    const size_t bufferMinimo = 64 * 1024; // 64 KiB por buffer como mínimo
+    ResultadoOrdenamiento resultado;
+    ArchivosTemporales temporales(directorioTemporal);
+
+    /**
+     * Fase 1: generación de corridas ordenadas.
+     */
+    vector<string> corridas;
+    {
+        ifstream archivo(entrada, ios::binary);
+        if (!archivo.is_open()) throw runtime_error("No se pudo abrir " + entrada);
+        vector<T> bloque(max<size_t>(presupuesto / sizeof(T), 1));
+        while (archivo) {
+            archivo.read(reinterpret_cast<char *>(bloque.data()), bloque.size() * sizeof(T));
+            if (archivo.bad()) throw runtime_error("Error al leer " + entrada);
+            size_t bytes = static_cast<size_t>(archivo.gcount());
+            if (bytes % sizeof(T) != 0) {
+                throw runtime_error(entrada + " termina con un registro incompleto de " + to_string(bytes % sizeof(T)) + " bytes");
+            }
+            size_t n = bytes / sizeof(T);
+            if (n == 0) break;
+            sort(bloque.begin(), bloque.begin() + n, cmp);
+            string ruta = temporales.nueva();
+            ofstream corrida(ruta, ios::binary | ios::trunc);
+            corrida.write(reinterpret_cast<const char *>(bloque.data()), n * sizeof(T));
+            corrida.close();
+            if (!corrida) throw runtime_error("No se pudo escribir la corrida " + ruta);
+            corridas.push_back(ruta);
+            resultado.registros += n;
+        }
+    }
+    resultado.corridas = corridas.size();
+
+    if (corridas.empty()) {
+        ofstream vacio(salida, ios::binary | ios::trunc);
+        if (!vacio.is_open()) throw runtime_error("No se pudo crear el archivo " + salida);
+        return resultado;
+    }
+
+    /**
+     * Fase 2: mezcla k-way. Cada corrida abierta usa dos buffers de lectura y
+     * la salida otros dos, por lo que el grado de mezcla máximo depende del
+     * presupuesto. Aun con un presupuesto muy chico, cada buffer mide al menos
+     * bufferMinimo: con buffers de unos cuantos registros, el costo de cada
+     * lectura o escritura dominaría.
+     */
+    size_t buffersDisponibles = presupuesto / (2 * bufferMinimo);
+    size_t gradoMaximo = buffersDisponibles > 3 ? buffersDisponibles - 1 : 2;
+    while (corridas.size() > 1 || resultado.pasadasMezcla == 0) {
+        bool ultimaPasada = corridas.size() <= gradoMaximo;
+        vector<string> siguientes;
+        for (size_t inicio = 0; inicio < corridas.size(); inicio += gradoMaximo) {
+            size_t fin = min(inicio + gradoMaximo, corridas.size());
+            size_t k = fin - inicio;
+            size_t registrosPorBuffer = max<size_t>(max(presupuesto / (2 * (k + 1)), bufferMinimo) / sizeof(T), 1);
+
+            string destino = ultimaPasada ? salida : temporales.nueva();
+            {
+                vector<unique_ptr<LectorCorrida<T>>> lectores;
+                vector<LectorCorrida<T> *> punteros;
+                for (size_t i = inicio; i < fin; i++) {
+                    lectores.emplace_back(new LectorCorrida<T>(corridas[i], registrosPorBuffer));
+                    punteros.push_back(lectores.back().get());
+                }
+                EscritorBuffer<T> escritor(destino, registrosPorBuffer);
+                ArbolPerdedores<T, Comparador> arbol(punteros, cmp);
+                while (!arbol.vacio()) {
+                    escritor.escribir(arbol.minimo());
+                    arbol.avanzar();
+                }
+                escritor.cerrar();
+            }
+            for (size_t i = inicio; i < fin; i++) filesystem::remove(corridas[i]);
+            siguientes.push_back(destino);
+        }
+        corridas = siguientes;
+        resultado.pasadasMezcla++;
+    }
+
+    return resultado;
+}
+
+#endif
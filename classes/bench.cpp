@@ -0,0 +1,246 @@
+#include <iostream>
+#include <chrono>
+#include <fstream>
+#include <queue>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "pokemon.h"
+#include "pokemon_store.h"
+#include "temporizadores.h"
+
+using namespace std;
+
+// Memoria residente (RSS) del proceso en KiB
+long rssKiB() {
+    long paginas = 0, residentes = 0;
+    ifstream statm("/proc/self/statm");
+    statm >> paginas >> residentes;
+    return residentes * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * Ejecuta 'rondas' ciclos de crear N Pokémon y luego destruirlos. Cada prueba
+ * corre en un proceso hijo (fork) para que la RSS medida sea solo la suya.
+ */
+template <typename Crear, typename Destruir>
+void medir(const char *nombre, size_t n, int rondas, Crear crear, Destruir destruir) {
+    if (fork() != 0) {
+        wait(nullptr);
+        return;
+    }
+    vector<Pokemon *> pokemons(n);
+    long rssInicial = rssKiB(), rssMaxima = 0;
+    auto inicio = chrono::steady_clock::now();
+    for (int r = 0; r < rondas; r++) {
+        for (size_t i = 0; i < n; i++) pokemons[i] = crear(i);
+        rssMaxima = max(rssMaxima, rssKiB());
+        destruir(pokemons);
+    }
+    chrono::duration<double> segundos = chrono::steady_clock::now() - inicio;
+
+    cout << nombre << ": " << (n * rondas) / segundos.count() / 1e6 << " M crear+destruir/s, RSS +"
+         << (rssMaxima - rssInicial) / 1024 << " MiB para " << n << " objetos" << endl;
+    _exit(0);
+}
+
+/**
+ * Operaciones masivas sobre 10^7 Pokémon: vector<Pokemon> (AoS) contra
+ * PokemonStore (SoA).
+ */
+void benchStore() {
+    const size_t N = 10000000;
+    cout.setstate(ios::badbit);
+    vector<Pokemon> aos;
+    aos.reserve(N);
+    PokemonStore soa;
+    soa.reservar(N);
+    for (size_t i = 0; i < N; i++) {
+        int poder = (i * 2654435761u) % 100;
+        aos.emplace_back("Pokemon", poder);
+        aos.back().captured = i % 3 == 0;
+        soa.agregar("Pokemon", poder, i % 3 == 0);
+    }
+
+    auto tiempo = [](auto funcion) {
+        auto inicio = chrono::steady_clock::now();
+        funcion();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+    };
+    long long totalAos = 0, totalSoa = 0;
+    size_t filtradosAos = 0, filtradosSoa = 0;
+
+    double filtroAos = tiempo([&]() {
+        for (const Pokemon &p : aos) filtradosAos += p.captured && p.power >= 50;
+    });
+    double filtroSoa = tiempo([&]() {
+        filtradosSoa = (soa.filtrarCapturados() & soa.filtrarPorPoder(50, 100)).contar();
+    });
+
+    // setSleeping() y no sleep(): así ninguno de los dos lados mide el formateo de cout
+    double sleepAos = tiempo([&]() {
+        for (Pokemon &p : aos) if (p.captured && p.power >= 50) p.setSleeping(true);
+    });
+    double sleepSoa = tiempo([&]() {
+        soa.sleep(soa.filtrarCapturados() & soa.filtrarPorPoder(50, 100));
+    });
+
+    double attackAos = tiempo([&]() {
+        for (const Pokemon &p : aos) if (!p.isSleeping()) totalAos += p.power;
+    });
+    double attackSoa = tiempo([&]() {
+        totalSoa = soa.attack();
+    });
+    // Destruyendo los objetos antes de volver a activar cout
+    aos = vector<Pokemon>();
+    cout.clear();
+
+    cout << "10^7 Pokémon\t\tvector<Pokemon>\tPokemonStore" << endl;
+    cout << "Filtro (ms)\t\t" << filtroAos << "\t\t" << filtroSoa << (filtradosAos == filtradosSoa ? "" : "  (!)") << endl;
+    cout << "sleep (ms)\t\t" << sleepAos << "\t\t" << sleepSoa << endl;
+    cout << "attack (ms)\t\t" << attackAos << "\t\t" << attackSoa << (totalAos == totalSoa ? "" : "  (!)") << endl;
+}
+
+/**
+ * Costo por evento de la traza contra imprimir con cout (hacia /dev/null para
+ * no medir la terminal).
+ */
+void benchTraza() {
+    const int EVENTOS = 10000000;
+    const int LOTE = BufferTraza::CAPACIDAD / 2;
+    ofstream descarte("/dev/null");
+    Traza::volcar(descarte);
+    uint64_t descartadosAntes = Traza::descartados();
+
+    /**
+     * Se mide solo el camino caliente: se emite medio buffer, se detiene el reloj
+     * y se vuelca (formatea) fuera de la medición, como lo haría un consumidor.
+     */
+    double nsTotales = 0;
+    for (int emitidos = 0; emitidos < EVENTOS; emitidos += LOTE) {
+        auto inicio = chrono::steady_clock::now();
+        for (int i = 0; i < LOTE; i++) TRAZA(TRAZA_POKEMON_CONSTRUCTOR, i, 0x756863616B6950ULL, 0);
+        nsTotales += chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count();
+        Traza::volcar(descarte);
+    }
+    double nsTraza = nsTotales / EVENTOS;
+
+    const int LINEAS = 1000000;
+    string nombre = "Pikachu";
+    auto inicio = chrono::steady_clock::now();
+    for (int i = 0; i < LINEAS; i++) descarte << "-->> Constructor de " << nombre << " ejecutado <<--" << endl;
+    double nsCout = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / LINEAS;
+
+    cout << "Traza " << (TRAZA_HABILITADA ? "habilitada" : "deshabilitada (-DTRAZA_HABILITADA=0)") << ": "
+         << nsTraza << " ns/evento (" << Traza::descartados() - descartadosAntes << " descartados)" << endl;
+    cout << "cout + endl: " << nsCout << " ns/línea" << endl;
+}
+
+/**
+ * Rotación de temporizadores (churn): N Pokémon con un temporizador activo
+ * cada uno. En cada tick algunos se reprograman (cancelar + programar, como
+ * reiniciar un tiempo de espera) y los que vencen se vuelven a programar.
+ *
+ * std::priority_queue no permite cancelar, así que se usa borrado perezoso:
+ * cada Pokémon lleva una versión y las entradas viejas se descartan al salir.
+ */
+uint32_t mezclar(uint64_t valor) {
+    valor ^= valor >> 33;
+    valor *= 0xff51afd7ed558ccdULL;
+    valor ^= valor >> 33;
+    return uint32_t(valor);
+}
+
+void benchTemporizadores() {
+    const uint32_t N = 1000000;
+    const uint64_t TICKS = 4000;
+    const uint32_t REPROGRAMADOS = 2000;
+    // Duración pseudoaleatoria entre 1 y 4096 ticks, igual para ambas estructuras
+    auto duracion = [](uint64_t pokemon, uint64_t tick) { return 1 + mezclar(pokemon * 7919 + tick) % 4096; };
+
+    auto inicio = chrono::steady_clock::now();
+    RuedaTemporizadores rueda;
+    rueda.reservar(N);
+    vector<IdTemporizador> ids(N);
+    size_t operacionesRueda = 0, vencidosRueda = 0;
+    for (uint32_t p = 0; p < N; p++) ids[p] = rueda.programarEn(duracion(p, 0), p);
+    for (uint64_t t = 1; t <= TICKS; t++) {
+        for (uint32_t k = 0; k < REPROGRAMADOS; k++) {
+            uint32_t p = mezclar(t * REPROGRAMADOS + k) % N;
+            rueda.cancelar(ids[p]);
+            ids[p] = rueda.programar(t + duracion(p, t), p);
+        }
+        vencidosRueda += rueda.avanzar(t, [&](const vector<uint64_t> &vencidos) {
+            for (uint64_t p : vencidos) ids[p] = rueda.programar(t + duracion(p, t), p);
+        });
+    }
+    operacionesRueda = N + 2 * size_t(REPROGRAMADOS) * TICKS + 2 * vencidosRueda;
+    double segundosRueda = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    struct Entrada {
+        uint64_t vence;
+        uint32_t pokemon;
+        uint32_t version;
+        bool operator>(const Entrada &otra) const { return vence > otra.vence; }
+    };
+    inicio = chrono::steady_clock::now();
+    priority_queue<Entrada, vector<Entrada>, greater<Entrada>> cola;
+    vector<uint32_t> versiones(N, 0);
+    size_t vencidosCola = 0;
+    for (uint32_t p = 0; p < N; p++) cola.push({ duracion(p, 0), p, 0 });
+    for (uint64_t t = 1; t <= TICKS; t++) {
+        for (uint32_t k = 0; k < REPROGRAMADOS; k++) {
+            uint32_t p = mezclar(t * REPROGRAMADOS + k) % N;
+            cola.push({ t + duracion(p, t), p, ++versiones[p] });
+        }
+        while (!cola.empty() && cola.top().vence <= t) {
+            Entrada e = cola.top();
+            cola.pop();
+            if (e.version != versiones[e.pokemon]) continue;
+            vencidosCola++;
+            cola.push({ t + duracion(e.pokemon, t), e.pokemon, ++versiones[e.pokemon] });
+        }
+    }
+    double segundosCola = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << N << " temporizadores, " << TICKS << " ticks, " << REPROGRAMADOS << " reprogramados por tick" << endl;
+    cout << "RuedaTemporizadores: " << operacionesRueda / segundosRueda / 1e6 << " M operaciones/s, "
+         << vencidosRueda << " vencidos" << endl;
+    cout << "priority_queue: " << operacionesRueda / segundosCola / 1e6 << " M operaciones/s, "
+         << vencidosCola << " vencidos, " << cola.size() << " entradas en la cola ("
+         << cola.size() - N << " canceladas sin sacar)" << endl;
+}
+
+int main() {
+
+    const size_t N = 1000000;
+    const int RONDAS = 10;
+
+    medir("new/delete global", N, RONDAS,
+        [](size_t i) { return ::new Pokemon("Pikachu", i); },
+        [](vector<Pokemon *> &v) { for (Pokemon *p : v) ::delete p; }
+    );
+
+    medir("PoolObjetos (new/delete de Pokemon)", N, RONDAS,
+        [](size_t i) { return new Pokemon("Pikachu", i); },
+        [](vector<Pokemon *> &v) { for (Pokemon *p : v) delete p; }
+    );
+
+    ArenaMonotonica arena;
+    medir("ArenaMonotonica", N, RONDAS,
+        [&arena](size_t i) { return Pokemon::crearEn(arena, "Pikachu", i); },
+        [&arena](vector<Pokemon *> &) { arena.liberar(); }
+    );
+
+    cout << endl;
+    benchStore();
+
+    cout << endl;
+    benchTraza();
+
+    cout << endl;
+    benchTemporizadores();
+
+    return 0;
+}
@@ -1,106 +1,26 @@
 #include <iostream>
 #include <string>
-
-using namespace std;
-
 /**
- * La diferencia entre una clase y una estructura es que la estructura (struct) tiene
- * miembros de acceso público por defecto, mientras que en una clase sus miembros son
- * privados por defecto, mientras que también puede utilizar modificadores de
- * acceso (public, private, protected) para restringir o permitir el acceso de sus
- * miembros desde fuera de la clase.
- * 
- * Además, una estructura no tiene un método constructor.
+ * La clase Pokemon vive en su propio archivo de cabecera para poder
+ * reutilizarla desde los benchmarks (bench.cpp).
  */
-class Pokemon {
-    // En el caso de C++, se abre una lista de los miembros que serán públicos
-    public:
-        // Miembros de la clase con acceso público
-        string name;
-        int power;
-        bool captured = false; // <-- Propiedad con valor por defecto
-        void attack() {
-            cout << name << " ataca con " << power << " de poder" << endl;
-        }
-        void sleep() {
-            if (sleeping) {
-                cout << name << " ya estába durmiendo..." << endl;
-            } else {
-                cout << name << " comenzó a dormir..." << endl;
-            }
-            sleeping = true;
-        }
-        Pokemon &updateName(string name) {
-            /**
-             * En otros casos, el puntero this será útil cuando se necesita
-             * acceder a la instancia desde la clase misma.
-             */
-            cout << this->name << " ahora es " << name << "!" << endl;
-            this->name = name;
-            /**
-             * También puede ser útil para retornar la instancia misma y
-             * encadenar métodos de forma que pueda lograrse una lectura
-             * de código más humana, como por ejemplo:
-             * 
-             * instance.play().stop("abc").others(9);
-             * 
-             * Se retorna el puntero (*) de this y se indica el tipo y símbolo de
-             * amperson (&) en el método para indicar que se tomará el valor
-             * del puntero, que en este caso viene a ser la instancia.
-             */
-            return *this;
-        }
-        /**
-         * Un constructor es un bloque de código que se ejecutará al momento de
-         * que se cree una nueva instancia de clase y que además puede recibir
-         * parámetros de todo tipo.
-         * 
-         * Es posible hacer una sobrecarga de constructores en donde la única
-         * diferencia entre ellos es la cantidad y tipos de parámetros que reciben.
-         * 
-         * La siguiente sintaxis de constructor:
-         *   Pokemon(string a, int b) {
-         *     name = a;
-         *     power = b;
-         *   }
-         * Es equivalente a la sintaxis de asignación in-line:
-         *   Pokemon(string a, int b) : name(n), power(b) {
-         *     // code
-         *   }
-         * Pero, en la práctica es más conveniente utilizar el puntero
-         * this el cual es una autoreferencia de la clase, y permite
-         * referirse a las propiedades de clase de forma adecuada y sin ambiguedades:
-         */
-        Pokemon(string name, int power) {
-            this->name = name;
-            this->power = power;
-            cout << "-->> Constructor de " << name << " ejecutado <<--" << endl;
-        }
-        /**
-         * Sintaxis de destructor, comenzando siempre por virgulilla (~).
-         * 
-         * C++ invoca en tiempo de ejecución al método destructor cuando la
-         * instancia del objeto ya no se necesita más, pero es buena práctica
-         * invocarlo manualmente para preveer escenarios donde se asigne memoria
-         * de forma dinámica dentro del objeto, como p. ej., en funciones. A
-         * diferencia de otros lenguajes de programación, C++ no tiene un
-         * recolector de basura que haga esta tarea por nosotros.
-         * 
-         * Es importante que lo anterior solo sucede de forma automática cuando
-         * se crean instancias de clase en las que su memoria fue asignada por el
-         * compilador, o en otras palabras, cuando no se usa la sintaxis new. En este
-         * caso en particular, es obligatorio liberar la memoria manualmente.
-         */
-        ~Pokemon() {
-            cout << "-->> Destructor de " << name << " ejecutado <<--" << endl;
-        }
-    private:
-        // Miembros de la clase con acceso privado
-        bool sleeping = false;
-};
+#include "pokemon.h"
+#include "pokemon_store.h"
+/**
+ * Temporizadores para dormir y despertar Pokémon después de cierto tiempo.
+ */
+#include "temporizadores.h"
+
+using namespace std;
 
 int main() {
 
+    /**
+     * El constructor y destructor de Pokemon ya no imprimen directamente, sino que
+     * registran eventos de traza. Aquí se pide imprimirlos todos al terminar.
+     */
+    Traza::volcarAlSalir();
+
     // Declarando nueva instancia de clase
     Pokemon pikachu = Pokemon("Pikachu", 30);
     pikachu.power = 35;
@@ -135,6 +55,61 @@ int main() {
     // La palabra reservada delete liberará la memoria ocupada por el puntero indicado
     delete charizard;
 
+    cout << endl;
+
+    /**
+     * Cuando muchos objetos comparten el mismo tiempo de vida, pueden crearse
+     * dentro de una arena y liberarse todos juntos. Los destructores se invocan
+     * en orden inverso al de creación.
+     */
+    ArenaMonotonica arena;
+    Pokemon *bulbasaur = Pokemon::crearEn(arena, "Bulbasaur", 20);
+    Pokemon *squirtle = Pokemon::crearEn(arena, "Squirtle", 25);
+    bulbasaur->attack();
+    squirtle->attack();
+    cout << "Liberando la arena completa" << endl;
+    arena.liberar();
+
+    cout << endl;
+
+    /**
+     * Para operaciones sobre muchos Pokémon a la vez, PokemonStore guarda cada
+     * propiedad en su propia columna y opera sobre selecciones completas.
+     */
+    PokemonStore store;
+    store.agregar("Eevee", 15, true);
+    store.agregar("Snorlax", 60);
+    store.agregar("Mewtwo", 90, true);
+
+    Seleccion fuertes = store.filtrarPorPoder(50, 100);
+    cout << "Pokémon con poder entre 50 y 100: " << fuertes.contar() << endl;
+    store.sleep(fuertes & store.filtrarCapturados());
+    cout << "Mewtwo duerme: " << store.sleeping(2) << endl;
+    cout << "Poder total de los Pokémon despiertos: " << store.attack() << endl;
+
+    cout << endl;
+
+    /**
+     * sleep() no dice por cuánto tiempo. Con una rueda de temporizadores se
+     * programa el despertar; aquí los ticks son turnos simulados del juego.
+     */
+    RuedaTemporizadores rueda;
+    store.sleep(0);
+    rueda.programarEn(3, 0);  // Eevee despierta en 3 turnos
+    IdTemporizador snorlax = rueda.programarEn(100, 1);
+    store.sleep(1);
+    // Snorlax ya no despertará solo
+    rueda.cancelar(snorlax);
+    for (int turno = 1; turno <= 5; turno++) {
+        rueda.avanzar(turno, [&](const vector<uint64_t> &despiertan) {
+            for (uint64_t i : despiertan) {
+                store.wake(i);
+                cout << "Turno " << turno << ": " << store.name(i) << " despertó" << endl;
+            }
+        });
+    }
+    cout << "Eevee duerme: " << store.sleeping(0) << ", Snorlax duerme: " << store.sleeping(1) << endl;
+
     return 0;
 }
 
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Asignadores de memoria especializados.
+ *
+ * Cada 'new' y 'delete' global pasa por el asignador general del sistema
+ * (malloc/free), que tiene que servir bloques de cualquier tamaño y agrega
+ * encabezados a cada uno. Cuando se crean y destruyen millones de objetos del
+ * mismo tipo conviene usar estructuras más simples:
+ *
+ *   - PoolObjetos: casillas del tamaño exacto de T. Las casillas libres forman
+ *     una lista enlazada intrusiva (el puntero "siguiente" se guarda dentro de
+ *     la misma casilla libre), por lo que reservar y liberar es O(1).
+ *   - ArenaMonotonica: solo avanza un cursor dentro de bloques grandes. No se
+ *     liberan objetos individuales, sino todos a la vez (p. ej. al terminar un
+ *     turno del juego).
+ *
+ * Ninguno de los dos es seguro para usarse desde varios hilos a la vez.
+ */
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+template <typename T, size_t CasillasPorBloque = 4096>
+class PoolObjetos {
+    public:
+        PoolObjetos() = default;
+        PoolObjetos(const PoolObjetos &) = delete;
+        PoolObjetos &operator=(const PoolObjetos &) = delete;
+
+        // Memoria sin inicializar para un T
+        void *reservar() {
+            if (libre == nullptr) this->crecer();
+            Casilla *casilla = libre;
+            libre = casilla->siguiente;
+            return casilla;
+        }
+        void liberar(void *puntero) {
+            Casilla *casilla = static_cast<Casilla *>(puntero);
+            casilla->siguiente = libre;
+            libre = casilla;
+        }
+
+        /**
+         * Se usa ::new para llamar al new de colocación global, ya que T puede
+         * definir su propio operator new (como Pokemon).
+         */
+        template <typename... Args>
+        T *crear(Args &&... args) {
+            void *memoria = this->reservar();
+            try {
+                return ::new (memoria) T(forward<Args>(args)...);
+            } catch (...) {
+                this->liberar(memoria);
+                throw;
+            }
+        }
+        void destruir(T *objeto) {
+            objeto->~T();
+            this->liberar(objeto);
+        }
+
+        // Bytes reservados al sistema por el pool
+        size_t capacidad() const {
+            return bloques.size() * CasillasPorBloque * sizeof(Casilla);
+        }
+    private:
+        union Casilla {
+            Casilla *siguiente;
+            alignas(T) unsigned char datos[sizeof(T)];
+        };
+        vector<unique_ptr<Casilla[]>> bloques;
+        Casilla *libre = nullptr;
+
+        void crecer() {
+            bloques.emplace_back(new Casilla[CasillasPorBloque]);
+            Casilla *bloque = bloques.back().get();
+            for (size_t i = 0; i < CasillasPorBloque; i++) {
+                bloque[i].siguiente = i + 1 < CasillasPorBloque ? &bloque[i + 1] : libre;
+            }
+            libre = bloque;
+        }
+};
+
+class ArenaMonotonica {
+    public:
+        ArenaMonotonica(size_t tamanioBloque = 1024 * 1024) {
+            this->tamanioBloque = tamanioBloque;
+        }
+        ~ArenaMonotonica() {
+            this->liberar();
+        }
+        ArenaMonotonica(const ArenaMonotonica &) = delete;
+        ArenaMonotonica &operator=(const ArenaMonotonica &) = delete;
+
+        void *reservar(size_t tamanio, size_t alineacion = alignof(max_align_t)) {
+            void *puntero = cursor;
+            if (cursor == nullptr || !align(alineacion, tamanio, puntero, disponible)) {
+                this->siguienteBloque(tamanio + alineacion);
+                puntero = cursor;
+                align(alineacion, tamanio, puntero, disponible);
+            }
+            cursor = static_cast<unsigned char *>(puntero) + tamanio;
+            disponible -= tamanio;
+            return puntero;
+        }
+
+        /**
+         * Construye un T dentro de la arena. Si T tiene destructor no trivial (p. ej.
+         * contiene un string), se registra para invocarlo en liberar().
+         */
+        template <typename T, typename... Args>
+        T *crear(Args &&... args) {
+            T *objeto = ::new (this->reservar(sizeof(T), alignof(T))) T(forward<Args>(args)...);
+            if constexpr (!is_trivially_destructible<T>::value) {
+                void *memoria = this->reservar(sizeof(Destructor), alignof(Destructor));
+                destructores = ::new (memoria) Destructor{ [](void *o) { static_cast<T *>(o)->~T(); }, objeto, destructores };
+            }
+            return objeto;
+        }
+
+        /**
+         * Destruye todos los objetos (en orden inverso de creación) y regresa el
+         * cursor al primer bloque. Los bloques se conservan para reutilizarse.
+         */
+        void liberar() {
+            for (Destructor *d = destructores; d != nullptr; d = d->anterior) d->destruir(d->objeto);
+            destructores = nullptr;
+            actual = 0;
+            if (bloques.empty()) return;
+            cursor = bloques[0].memoria.get();
+            disponible = bloques[0].tamanio;
+        }
+
+        // Bytes reservados al sistema por la arena
+        size_t capacidad() const {
+            size_t total = 0;
+            for (const Bloque &b : bloques) total += b.tamanio;
+            return total;
+        }
+    private:
+        struct Bloque {
+            unique_ptr<unsigned char[]> memoria;
+            size_t tamanio;
+        };
+        struct Destructor {
+            void (*destruir)(void *);
+            void *objeto;
+            Destructor *anterior;
+        };
+        vector<Bloque> bloques;
+        size_t actual = 0;
+        size_t tamanioBloque;
+        unsigned char *cursor = nullptr;
+        size_t disponible = 0;
+        Destructor *destructores = nullptr;
+
+        void siguienteBloque(size_t minimo) {
+            // Reutilizando bloques de un ciclo anterior si son suficientemente grandes
+            while (cursor != nullptr && actual + 1 < bloques.size()) {
+                actual++;
+                if (bloques[actual].tamanio >= minimo) {
+                    cursor = bloques[actual].memoria.get();
+                    disponible = bloques[actual].tamanio;
+                    return;
+                }
+            }
+            size_t tamanio = max(minimo, tamanioBloque);
+            bloques.push_back({ unique_ptr<unsigned char[]>(new unsigned char[tamanio]), tamanio });
+            actual = bloques.size() - 1;
+            cursor = bloques.back().memoria.get();
+            disponible = tamanio;
+        }
+};
+
+#endif
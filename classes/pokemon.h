@@ -0,0 +1,204 @@
+#include <iostream>
+#include <mutex>
+#include <string>
+#include "memoria.h"
+#include "traza.h"
+
+using namespace std;
+
+#ifndef POKEMON_H
+#define POKEMON_H
+
+/**
+ * Eventos de traza del ciclo de vida de un Pokémon. El texto de cada uno se
+ * genera hasta que la traza se vuelca, no al momento de crear o destruir.
+ */
+enum EventoPokemon : uint32_t {
+    TRAZA_POKEMON_CONSTRUCTOR = 1,
+    TRAZA_POKEMON_DESTRUCTOR = 2
+};
+
+inline void formatearConstructorPokemon(ostream &salida, const EventoTraza &e) {
+    char nombre[17];
+    salida << "-->> Constructor de " << Traza::desempaquetar(e, nombre) << " (poder " << e.dato << ") ejecutado <<--";
+}
+
+inline void formatearDestructorPokemon(ostream &salida, const EventoTraza &e) {
+    char nombre[17];
+    salida << "-->> Destructor de " << Traza::desempaquetar(e, nombre) << " ejecutado <<--";
+}
+
+inline const bool trazasPokemonDefinidas = (
+    Traza::definir(TRAZA_POKEMON_CONSTRUCTOR, "Pokemon::Pokemon", formatearConstructorPokemon),
+    Traza::definir(TRAZA_POKEMON_DESTRUCTOR, "Pokemon::~Pokemon", formatearDestructorPokemon),
+    true
+);
+
+/**
+ * La diferencia entre una clase y una estructura es que la estructura (struct) tiene
+ * miembros de acceso público por defecto, mientras que en una clase sus miembros son
+ * privados por defecto, mientras que también puede utilizar modificadores de
+ * acceso (public, private, protected) para restringir o permitir el acceso de sus
+ * miembros desde fuera de la clase.
+ * 
+ * Además, una estructura no tiene un método constructor.
+ */
+class Pokemon {
+    // En el caso de C++, se abre una lista de los miembros que serán públicos
+    public:
+        // Miembros de la clase con acceso público
+        string name;
+        int power;
+        bool captured = false; // <-- Propiedad con valor por defecto
+        void attack() {
+            cout << name << " ataca con " << power << " de poder" << endl;
+        }
+        void sleep() {
+            if (sleeping) {
+                cout << name << " ya estába durmiendo..." << endl;
+            } else {
+                cout << name << " comenzó a dormir..." << endl;
+            }
+            sleeping = true;
+        }
+        void wake() {
+            if (sleeping) cout << name << " despertó!" << endl;
+            sleeping = false;
+        }
+        bool isSleeping() const {
+            return sleeping;
+        }
+        // Sin mensaje: para operaciones masivas, donde imprimir por cada uno dominaría
+        void setSleeping(bool sleeping) {
+            this->sleeping = sleeping;
+        }
+        Pokemon &updateName(string name) {
+            /**
+             * En otros casos, el puntero this será útil cuando se necesita
+             * acceder a la instancia desde la clase misma.
+             */
+            cout << this->name << " ahora es " << name << "!" << endl;
+            // El parámetro ya es una copia propia, así que se mueve en lugar de copiarse otra vez
+            this->name = move(name);
+            /**
+             * También puede ser útil para retornar la instancia misma y
+             * encadenar métodos de forma que pueda lograrse una lectura
+             * de código más humana, como por ejemplo:
+             * 
+             * instance.play().stop("abc").others(9);
+             * 
+             * Se retorna el puntero (*) de this y se indica el tipo y símbolo de
+             * amperson (&) en el método para indicar que se tomará el valor
+             * del puntero, que en este caso viene a ser la instancia.
+             */
+            return *this;
+        }
+        /**
+         * Un constructor es un bloque de código que se ejecutará al momento de
+         * que se cree una nueva instancia de clase y que además puede recibir
+         * parámetros de todo tipo.
+         * 
+         * Es posible hacer una sobrecarga de constructores en donde la única
+         * diferencia entre ellos es la cantidad y tipos de parámetros que reciben.
+         * 
+         * La siguiente sintaxis de constructor:
+         *   Pokemon(string a, int b) {
+         *     name = a;
+         *     power = b;
+         *   }
+         * Es equivalente a la sintaxis de asignación in-line:
+         *   Pokemon(string a, int b) : name(n), power(b) {
+         *     // code
+         *   }
+         * Pero, en la práctica es más conveniente utilizar el puntero
+         * this el cual es una autoreferencia de la clase, y permite
+         * referirse a las propiedades de clase de forma adecuada y sin ambiguedades.
+         *
+         * Como el parámetro name se recibe por valor (ya es una copia), se mueve
+         * hacia el miembro con move() en lugar de copiarse una segunda vez:
+         */
+        Pokemon(string name, int power) {
+            this->name = move(name);
+            this->power = power;
+            this->trazar(TRAZA_POKEMON_CONSTRUCTOR);
+        }
+        /**
+         * Sintaxis de destructor, comenzando siempre por virgulilla (~).
+         * 
+         * C++ invoca en tiempo de ejecución al método destructor cuando la
+         * instancia del objeto ya no se necesita más, pero es buena práctica
+         * invocarlo manualmente para preveer escenarios donde se asigne memoria
+         * de forma dinámica dentro del objeto, como p. ej., en funciones. A
+         * diferencia de otros lenguajes de programación, C++ no tiene un
+         * recolector de basura que haga esta tarea por nosotros.
+         * 
+         * Es importante que lo anterior solo sucede de forma automática cuando
+         * se crean instancias de clase en las que su memoria fue asignada por el
+         * compilador, o en otras palabras, cuando no se usa la sintaxis new. En este
+         * caso en particular, es obligatorio liberar la memoria manualmente.
+         */
+        ~Pokemon() {
+            this->trazar(TRAZA_POKEMON_DESTRUCTOR);
+        }
+        /**
+         * Una clase puede definir sus propios operadores new y delete. De esta forma
+         * 'new Pokemon(...)' y 'delete charizard' toman la memoria de un pool de
+         * casillas del tamaño exacto de un Pokemon en lugar del asignador general.
+         *
+         * Si una clase hija (más grande) hereda estos operadores, se delega al
+         * asignador global.
+         *
+         * PoolObjetos no es seguro entre hilos y todo 'new Pokemon' del programa
+         * pasa por el mismo pool, así que se toma un candado. Un pool por hilo
+         * evitaría el candado, pero un Pokemon puede destruirse en otro hilo
+         * (o después de que termine el hilo que lo creó).
+         */
+        static void *operator new(size_t tamanio) {
+            if (tamanio != sizeof(Pokemon)) return ::operator new(tamanio);
+            PoolCompartido &compartido = pool();
+            lock_guard<mutex> candado(compartido.candado);
+            return compartido.casillas.reservar();
+        }
+        static void operator delete(void *puntero, size_t tamanio) {
+            if (tamanio != sizeof(Pokemon)) return ::operator delete(puntero);
+            PoolCompartido &compartido = pool();
+            lock_guard<mutex> candado(compartido.candado);
+            compartido.casillas.liberar(puntero);
+        }
+        /**
+         * Para objetos que viven lo mismo (p. ej. todos los creados durante un
+         * turno del juego), una arena los libera a todos de una sola vez con
+         * arena.liberar(), sin invocar delete por cada uno.
+         */
+        static Pokemon *crearEn(ArenaMonotonica &arena, string name, int power) {
+            return arena.crear<Pokemon>(move(name), power);
+        }
+    private:
+        struct PoolCompartido {
+            mutex candado;
+            PoolObjetos<Pokemon> casillas;
+        };
+        static PoolCompartido &pool() {
+            static PoolCompartido instancia;
+            return instancia;
+        }
+
+        // Miembros de la clase con acceso privado
+        bool sleeping = false;
+
+        /**
+         * En lugar de imprimir con cout en cada constructor y destructor, se
+         * registra un evento binario (ver traza.h) que se formatea después.
+         */
+        void trazar(EventoPokemon evento) {
+#if TRAZA_HABILITADA
+            uint64_t arg0, arg1;
+            Traza::empaquetar(name, arg0, arg1);
+            TRAZA(evento, power, arg0, arg1);
+#else
+            (void)evento;
+#endif
+        }
+};
+
+#endif
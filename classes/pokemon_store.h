@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Almacén columnar (estructura de arreglos, SoA) de Pokémon.
+ *
+ * Un vector<Pokemon> guarda cada objeto completo uno tras otro (arreglo de
+ * estructuras, AoS): para sumar el poder de todos hay que recorrer también
+ * los nombres y banderas, ~40 bytes por Pokémon. En PokemonStore cada propiedad
+ * vive en su propio arreglo contiguo:
+ *
+ *   names     [ "Pikachu", "Charizard", ... ]
+ *   power     [ 35, 50, ... ]
+ *   captured  bits: 64 Pokémon por cada uint64_t
+ *   sleeping  bits: 64 Pokémon por cada uint64_t
+ *
+ * Así una operación masiva solo lee las columnas que necesita, y las banderas
+ * se procesan de 64 en 64 con operaciones de bits.
+ */
+#ifndef POKEMON_STORE_H
+#define POKEMON_STORE_H
+
+/**
+ * Resultado de un filtro: un bit encendido por cada Pokémon seleccionado. Se
+ * puede combinar con & y | antes de aplicar una operación masiva.
+ *
+ * Dos selecciones pueden medir distinto (una tomada antes de agregar() y otra
+ * después): las palabras que le faltan a la más corta cuentan como ceros.
+ */
+class Seleccion {
+    public:
+        vector<uint64_t> bits;
+
+        Seleccion(size_t cantidad = 0) : bits((cantidad + 63) / 64, 0) {}
+        Seleccion operator&(const Seleccion &otra) const {
+            Seleccion r = bits.size() >= otra.bits.size() ? *this : otra;
+            size_t comunes = min(bits.size(), otra.bits.size());
+            for (size_t i = 0; i < comunes; i++) r.bits[i] = bits[i] & otra.bits[i];
+            fill(r.bits.begin() + comunes, r.bits.end(), 0);
+            return r;
+        }
+        Seleccion operator|(const Seleccion &otra) const {
+            Seleccion r = bits.size() >= otra.bits.size() ? *this : otra;
+            size_t comunes = min(bits.size(), otra.bits.size());
+            for (size_t i = 0; i < comunes; i++) r.bits[i] = bits[i] | otra.bits[i];
+            return r;
+        }
+        size_t contar() const {
+            size_t total = 0;
+            for (uint64_t palabra : bits) total += __builtin_popcountll(palabra);
+            return total;
+        }
+        // Índices de los Pokémon seleccionados
+        vector<uint32_t> indices() const {
+            vector<uint32_t> r;
+            for (size_t i = 0; i < bits.size(); i++) {
+                for (uint64_t p = bits[i]; p != 0; p &= p - 1) r.push_back(i * 64 + __builtin_ctzll(p));
+            }
+            return r;
+        }
+};
+
+class PokemonStore {
+    public:
+        size_t agregar(string name, int power, bool captured = false) {
+            size_t i = names.size();
+            if (i % 64 == 0) {
+                capturedBits.push_back(0);
+                sleepingBits.push_back(0);
+            }
+            names.push_back(move(name));
+            powers.push_back(power);
+            if (captured) capturedBits[i / 64] |= 1ULL << (i % 64);
+            return i;
+        }
+        void reservar(size_t cantidad) {
+            names.reserve(cantidad);
+            powers.reserve(cantidad);
+            capturedBits.reserve((cantidad + 63) / 64);
+            sleepingBits.reserve((cantidad + 63) / 64);
+        }
+        size_t size() const {
+            return names.size();
+        }
+
+        // Acceso individual
+        const string &name(size_t i) const { return names[i]; }
+        int power(size_t i) const { return powers[i]; }
+        bool captured(size_t i) const { return (capturedBits[i / 64] >> (i % 64)) & 1; }
+        bool sleeping(size_t i) const { return (sleepingBits[i / 64] >> (i % 64)) & 1; }
+
+        /**
+         * Filtros: solo leen la columna involucrada.
+         */
+        Seleccion todos() const {
+            Seleccion s(this->size());
+            for (size_t i = 0; i < s.bits.size(); i++) s.bits[i] = this->mascaraValida(i);
+            return s;
+        }
+        Seleccion filtrarCapturados() const {
+            Seleccion s(this->size());
+            s.bits = capturedBits;
+            return s;
+        }
+        Seleccion filtrarDespiertos() const {
+            Seleccion s(this->size());
+            for (size_t i = 0; i < s.bits.size(); i++) s.bits[i] = ~sleepingBits[i] & this->mascaraValida(i);
+            return s;
+        }
+        Seleccion filtrarPorPoder(int minimo, int maximo) const {
+            Seleccion s(this->size());
+            const int *p = powers.data();
+            size_t n = powers.size();
+            for (size_t base = 0; base < n; base += 64) {
+                size_t fin = min(base + 64, n);
+                uint64_t palabra = 0;
+                // Bucle sin saltos: el compilador puede vectorizar las comparaciones
+                for (size_t i = base; i < fin; i++) {
+                    palabra |= static_cast<uint64_t>(p[i] >= minimo && p[i] <= maximo) << (i - base);
+                }
+                s.bits[base / 64] = palabra;
+            }
+            return s;
+        }
+
+        /**
+         * Ataque masivo: cada Pokémon seleccionado que esté despierto ataca. Regresa
+         * el poder total de los ataques. Solo lee 'power' y los bits de 'sleeping'.
+         */
+        long long attack(const Seleccion &seleccion) const {
+            this->validar(seleccion);
+            long long total = 0;
+            for (size_t i = 0; i < seleccion.bits.size(); i++) {
+                uint64_t atacan = seleccion.bits[i] & ~sleepingBits[i] & this->mascaraValida(i);
+                if (atacan == ~0ULL) {
+                    // Bloque completo: suma contigua de 64 valores
+                    const int *p = &powers[i * 64];
+                    for (int j = 0; j < 64; j++) total += p[j];
+                } else {
+                    for (; atacan != 0; atacan &= atacan - 1) total += powers[i * 64 + __builtin_ctzll(atacan)];
+                }
+            }
+            return total;
+        }
+        long long attack() const {
+            return this->attack(this->todos());
+        }
+
+        // Duerme a todos los seleccionados: 64 Pokémon por operación
+        void sleep(const Seleccion &seleccion) {
+            this->validar(seleccion);
+            for (size_t i = 0; i < seleccion.bits.size(); i++) sleepingBits[i] |= seleccion.bits[i] & this->mascaraValida(i);
+        }
+        void wake(const Seleccion &seleccion) {
+            this->validar(seleccion);
+            for (size_t i = 0; i < seleccion.bits.size(); i++) sleepingBits[i] &= ~seleccion.bits[i];
+        }
+        // Versiones individuales, p. ej. para despertar a un Pokémon cuando vence su temporizador
+        void sleep(size_t i) {
+            sleepingBits[i / 64] |= 1ULL << (i % 64);
+        }
+        void wake(size_t i) {
+            sleepingBits[i / 64] &= ~(1ULL << (i % 64));
+        }
+        void capture(const Seleccion &seleccion) {
+            this->validar(seleccion);
+            for (size_t i = 0; i < seleccion.bits.size(); i++) capturedBits[i] |= seleccion.bits[i] & this->mascaraValida(i);
+        }
+    private:
+        vector<string> names;
+        vector<int> powers;
+        vector<uint64_t> capturedBits;
+        vector<uint64_t> sleepingBits;
+
+        // Bits válidos de la palabra i (la última puede estar incompleta)
+        uint64_t mascaraValida(size_t i) const {
+            size_t restantes = this->size() - i * 64;
+            return restantes >= 64 ? ~0ULL : (1ULL << restantes) - 1;
+        }
+        /**
+         * Una selección más corta que el almacén (tomada antes de agregar más
+         * Pokémon) es válida; una más larga es de otro almacén. Los bits que
+         * sobran en la última palabra se descartan con mascaraValida().
+         */
+        void validar(const Seleccion &seleccion) const {
+            if (seleccion.bits.size() > capturedBits.size()) {
+                throw invalid_argument("La selección tiene más Pokémon que el almacén");
+            }
+        }
+};
+
+#endif
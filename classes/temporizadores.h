@@ -0,0 +1,242 @@
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Rueda jerárquica de temporizadores (hierarchical timing wheel).
+ *
+ * Una cola de prioridad (std::priority_queue) ordena los temporizadores por
+ * vencimiento: insertar y sacar cuestan O(log n) y no se puede cancelar uno
+ * sin buscarlo. La rueda los reparte en ranuras según cuánto falta para que
+ * venzan, como las manecillas de un reloj:
+ *
+ *   nivel 0: 256 ranuras de 1 tick          (vencen en menos de 256 ticks)
+ *   nivel 1: 256 ranuras de 256 ticks       (menos de 65,536 ticks)
+ *   nivel 2: 256 ranuras de 65,536 ticks
+ *   nivel 3: 256 ranuras de 16,777,216 ticks
+ *
+ * Cada ranura es una lista doblemente enlazada, así que insertar y cancelar
+ * son O(1). Cuando el nivel 0 completa una vuelta, la ranura que toca del
+ * nivel 1 se "derrama" (cascade) a ranuras más finas, y así sucesivamente.
+ *
+ * Al avanzar, todos los temporizadores que vencen en un mismo tick se
+ * entregan juntos en un solo llamado (lote). Cada temporizador lleva un dato
+ * de 64 bits libre, p. ej. el índice de un Pokémon y el tipo de evento
+ * (despertar, fin de un efecto, fin de un tiempo de espera).
+ *
+ * La rueda cuenta en ticks; RelojTicks convierte el reloj monótono del
+ * sistema a ticks, o se pueden usar ticks simulados (turnos del juego).
+ */
+#ifndef TEMPORIZADORES_H
+#define TEMPORIZADORES_H
+
+/**
+ * Identifica a un temporizador para cancelarlo. La generación detecta ids
+ * viejos: si el temporizador ya venció o se canceló, su casilla pudo haberse
+ * reutilizado con otra generación.
+ */
+struct IdTemporizador {
+    uint32_t indice;
+    uint32_t generacion;
+};
+
+class RuedaTemporizadores {
+    public:
+        static constexpr unsigned BITS_RANURA = 8;
+        static constexpr unsigned RANURAS = 1 << BITS_RANURA;
+        static constexpr unsigned NIVELES = 4;
+
+        explicit RuedaTemporizadores(uint64_t ahora = 0) {
+            this->actual = ahora;
+            for (uint32_t &cabeza : this->ranuras) cabeza = NINGUNO;
+        }
+
+        // Programa un temporizador que vence en el tick 'vence' (si ya pasó, en el siguiente)
+        IdTemporizador programar(uint64_t vence, uint64_t dato) {
+            uint32_t i = this->nuevoNodo();
+            Nodo &nodo = this->nodos[i];
+            // El tick actual ya se procesó
+            nodo.vence = vence > this->actual ? vence : this->actual + 1;
+            nodo.dato = dato;
+            this->enlazar(i);
+            this->pendientes++;
+            return { i, nodo.generacion };
+        }
+        IdTemporizador programarEn(uint64_t retraso, uint64_t dato) {
+            return this->programar(this->actual + retraso, dato);
+        }
+
+        // Regresa false si el temporizador ya había vencido o se había cancelado
+        bool cancelar(IdTemporizador id) {
+            if (id.indice >= this->nodos.size()) return false;
+            Nodo &nodo = this->nodos[id.indice];
+            if (nodo.generacion != id.generacion || nodo.ranura == NINGUNO) return false;
+            this->desenlazar(id.indice);
+            this->liberarNodo(id.indice);
+            this->pendientes--;
+            return true;
+        }
+
+        /**
+         * Avanza hasta el tick 'ahora'. Por cada tick con vencimientos llama a
+         * f(const vector<uint64_t> &datos) una sola vez con los datos de todos
+         * los que vencieron. Dentro de f se pueden programar o cancelar otros
+         * temporizadores. Regresa cuántos vencieron.
+         */
+        template <typename Funcion>
+        size_t avanzar(uint64_t ahora, Funcion f) {
+            size_t vencidos = 0;
+            while (this->actual < ahora) {
+                // Sin pendientes no hay nada que derramar ni entregar: se salta directo
+                if (this->pendientes == 0) {
+                    this->actual = ahora;
+                    break;
+                }
+                this->actual++;
+                this->derramar();
+                uint32_t &cabeza = this->ranuras[this->actual & (RANURAS - 1)];
+                if (cabeza == NINGUNO) continue;
+
+                // Se separa la lista completa antes de llamar a f, que puede programar más
+                uint32_t i = cabeza;
+                cabeza = NINGUNO;
+                this->lote.clear();
+                while (i != NINGUNO) {
+                    uint32_t siguiente = this->nodos[i].siguiente;
+                    this->lote.push_back(this->nodos[i].dato);
+                    this->liberarNodo(i);
+                    i = siguiente;
+                }
+                this->pendientes -= this->lote.size();
+                vencidos += this->lote.size();
+                f(const_cast<const vector<uint64_t> &>(this->lote));
+            }
+            return vencidos;
+        }
+
+        uint64_t ahora() const {
+            return this->actual;
+        }
+        size_t size() const {
+            return this->pendientes;
+        }
+        void reservar(size_t cantidad) {
+            this->nodos.reserve(cantidad);
+        }
+    private:
+        static constexpr uint32_t NINGUNO = UINT32_MAX;
+
+        struct Nodo {
+            uint64_t vence;
+            uint64_t dato;
+            uint32_t siguiente;
+            uint32_t anterior;
+            uint32_t generacion;
+            // Ranura donde está enlazado (NINGUNO si la casilla está libre)
+            uint32_t ranura;
+        };
+
+        uint64_t actual;
+        size_t pendientes = 0;
+        // Cabezas de las listas: NIVELES x RANURAS
+        uint32_t ranuras[NIVELES * RANURAS];
+        vector<Nodo> nodos;
+        // Casillas libres, enlazadas por 'siguiente'
+        uint32_t libre = NINGUNO;
+        vector<uint64_t> lote;
+
+        uint32_t nuevoNodo() {
+            if (this->libre != NINGUNO) {
+                uint32_t i = this->libre;
+                this->libre = this->nodos[i].siguiente;
+                return i;
+            }
+            this->nodos.push_back({ 0, 0, NINGUNO, NINGUNO, 0, NINGUNO });
+            return this->nodos.size() - 1;
+        }
+        void liberarNodo(uint32_t i) {
+            Nodo &nodo = this->nodos[i];
+            nodo.generacion++;
+            nodo.ranura = NINGUNO;
+            nodo.siguiente = this->libre;
+            this->libre = i;
+        }
+
+        /**
+         * El nivel se elige por la distancia al tick actual y la ranura por los
+         * bits del vencimiento que corresponden a ese nivel. Al derramar, un
+         * temporizador puede vencer en el mismo tick que se está procesando
+         * (distancia 0): va al nivel 0 y se entrega en ese tick.
+         */
+        uint32_t ranuraPara(uint64_t vence) const {
+            uint64_t distancia = vence - this->actual;
+            for (unsigned nivel = 0; nivel < NIVELES; nivel++) {
+                if (distancia < (uint64_t(1) << (BITS_RANURA * (nivel + 1)))) {
+                    return nivel * RANURAS + ((vence >> (BITS_RANURA * nivel)) & (RANURAS - 1));
+                }
+            }
+            // Más allá del último nivel: se estaciona en la ranura más lejana y se reacomoda al derramarse
+            uint64_t limite = this->actual + (uint64_t(1) << (BITS_RANURA * NIVELES)) - 1;
+            return (NIVELES - 1) * RANURAS + ((limite >> (BITS_RANURA * (NIVELES - 1))) & (RANURAS - 1));
+        }
+
+        void enlazar(uint32_t i) {
+            Nodo &nodo = this->nodos[i];
+            nodo.ranura = this->ranuraPara(nodo.vence);
+            uint32_t &cabeza = this->ranuras[nodo.ranura];
+            nodo.anterior = NINGUNO;
+            nodo.siguiente = cabeza;
+            if (cabeza != NINGUNO) this->nodos[cabeza].anterior = i;
+            cabeza = i;
+        }
+        void desenlazar(uint32_t i) {
+            Nodo &nodo = this->nodos[i];
+            if (nodo.anterior != NINGUNO) this->nodos[nodo.anterior].siguiente = nodo.siguiente;
+            else this->ranuras[nodo.ranura] = nodo.siguiente;
+            if (nodo.siguiente != NINGUNO) this->nodos[nodo.siguiente].anterior = nodo.anterior;
+        }
+
+        /**
+         * Cada vez que un nivel completa una vuelta, la ranura actual del nivel
+         * siguiente se reparte en los niveles más finos.
+         */
+        void derramar() {
+            for (unsigned nivel = 1; nivel < NIVELES; nivel++) {
+                // Los bits de los niveles inferiores deben ser cero: acaba de completarse una vuelta
+                if ((this->actual & ((uint64_t(1) << (BITS_RANURA * nivel)) - 1)) != 0) return;
+                uint32_t &cabeza = this->ranuras[nivel * RANURAS + ((this->actual >> (BITS_RANURA * nivel)) & (RANURAS - 1))];
+                uint32_t i = cabeza;
+                cabeza = NINGUNO;
+                while (i != NINGUNO) {
+                    uint32_t siguiente = this->nodos[i].siguiente;
+                    this->enlazar(i);
+                    i = siguiente;
+                }
+            }
+        }
+};
+
+/**
+ * Convierte el reloj monótono (steady_clock, nunca retrocede) a ticks de
+ * una resolución fija, contados desde que se creó el reloj.
+ */
+class RelojTicks {
+    public:
+        explicit RelojTicks(chrono::nanoseconds resolucion = chrono::milliseconds(1)) {
+            this->resolucion = resolucion;
+            this->origen = chrono::steady_clock::now();
+        }
+        uint64_t ahora() const {
+            return (chrono::steady_clock::now() - this->origen) / this->resolucion;
+        }
+        uint64_t ticks(chrono::nanoseconds duracion) const {
+            return duracion / this->resolucion;
+        }
+    private:
+        chrono::nanoseconds resolucion;
+        chrono::steady_clock::time_point origen;
+};
+
+#endif
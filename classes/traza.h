@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Sistema de trazas de bajo costo.
+ *
+ * Imprimir con cout en un constructor que se ejecuta millones de veces es
+ * muy caro: formatear texto, bloquear el stream y escribir a la consola. Aquí
+ * el código "caliente" solo copia un evento binario de 32 bytes (marca de
+ * tiempo, id del evento y dos argumentos) a un buffer circular del propio hilo.
+ * El texto se genera después, al volcar los eventos (volcar()) o desde un hilo
+ * consumidor en segundo plano (iniciarConsumidor()).
+ *
+ * Cada hilo tiene su propio buffer con un único productor y un único
+ * consumidor, por lo que no hacen falta candados: basta con dos índices
+ * atómicos. Si el buffer está lleno, el evento se descarta y se cuenta.
+ *
+ * Cada buffer mide 512 KiB. Cuando un hilo termina, el suyo se queda en el
+ * registro hasta que se vuelcan sus eventos y después lo toma el siguiente
+ * hilo que emita una traza: un programa que crea y termina hilos sin parar no
+ * acumula un buffer por cada uno.
+ *
+ * Compilando con -DTRAZA_HABILITADA=0 la macro TRAZA() desaparece por completo.
+ */
+#ifndef TRAZA_H
+#define TRAZA_H
+
+#ifndef TRAZA_HABILITADA
+#define TRAZA_HABILITADA 1
+#endif
+
+#if TRAZA_HABILITADA
+#define TRAZA(id, dato, arg0, arg1) Traza::emitir((id), (dato), (arg0), (arg1))
+#else
+#define TRAZA(id, dato, arg0, arg1) ((void)0)
+#endif
+
+struct EventoTraza {
+    uint64_t marca; // Ciclos del procesador (o nanosegundos si no hay rdtsc)
+    uint32_t id;
+    uint32_t dato;
+    uint64_t args[2];
+};
+
+// Función que convierte un evento a texto; se invoca fuera del camino caliente
+typedef void (*FormateadorTraza)(ostream &, const EventoTraza &);
+
+class BufferTraza {
+    public:
+        static constexpr uint64_t CAPACIDAD = 1 << 14; // Potencia de 2
+        uint32_t hilo;
+        atomic<uint64_t> descartados{0};
+
+        BufferTraza(uint32_t hilo) {
+            this->hilo = hilo;
+        }
+
+        // Solo lo invoca el hilo dueño del buffer
+        void escribir(const EventoTraza &evento) {
+            uint64_t h = cabeza.load(memory_order_relaxed);
+            if (h - colaVista == CAPACIDAD) {
+                colaVista = cola.load(memory_order_acquire);
+                if (h - colaVista == CAPACIDAD) {
+                    descartados.fetch_add(1, memory_order_relaxed);
+                    return;
+                }
+            }
+            eventos[h & (CAPACIDAD - 1)] = evento;
+            cabeza.store(h + 1, memory_order_release);
+        }
+
+        // Solo lo invoca el consumidor
+        template <typename Funcion>
+        size_t leer(Funcion f) {
+            uint64_t t = cola.load(memory_order_relaxed);
+            uint64_t h = cabeza.load(memory_order_acquire);
+            for (uint64_t i = t; i < h; i++) f(eventos[i & (CAPACIDAD - 1)]);
+            cola.store(h, memory_order_release);
+            return h - t;
+        }
+        // Sin eventos pendientes de volcar
+        bool vacio() const {
+            return cola.load(memory_order_acquire) == cabeza.load(memory_order_acquire);
+        }
+    private:
+        // Cada índice en su propia línea de caché para que productor y consumidor no compitan
+        alignas(64) atomic<uint64_t> cabeza{0};
+        uint64_t colaVista = 0;
+        alignas(64) atomic<uint64_t> cola{0};
+        alignas(64) EventoTraza eventos[CAPACIDAD];
+};
+
+class Traza {
+    public:
+        static inline uint64_t reloj() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+
+        static inline void emitir(uint32_t id, uint32_t dato, uint64_t arg0, uint64_t arg1) {
+            thread_local BufferDelHilo propio;
+            propio.buffer->escribir({ reloj(), id, dato, { arg0, arg1 } });
+        }
+
+        // Asocia un formateador a un id de evento
+        static void definir(uint32_t id, const char *nombre, FormateadorTraza formateador) {
+            Registro &r = registro();
+            lock_guard<mutex> candado(r.candado);
+            if (r.formateadores.size() <= id) r.formateadores.resize(id + 1);
+            r.formateadores[id] = { nombre, formateador };
+        }
+
+        /**
+         * Extrae los eventos pendientes de todos los hilos, los ordena por tiempo
+         * y los escribe como texto. Regresa la cantidad de eventos escritos.
+         */
+        static size_t volcar(ostream &salida) {
+            Registro &r = registro();
+            lock_guard<mutex> candado(r.candado);
+            vector<pair<EventoTraza, uint32_t>> eventos;
+            for (auto &b : r.buffers) {
+                b->leer([&](const EventoTraza &e) { eventos.push_back({ e, b->hilo }); });
+            }
+            stable_sort(eventos.begin(), eventos.end(), [](const auto &a, const auto &b) {
+                return a.first.marca < b.first.marca;
+            });
+            for (const auto &[e, hilo] : eventos) {
+                salida << "[" << r.nanosegundos(e.marca) / 1000.0 << " us, hilo " << hilo << "] ";
+                if (e.id < r.formateadores.size() && r.formateadores[e.id].formateador != nullptr) {
+                    r.formateadores[e.id].formateador(salida, e);
+                } else {
+                    salida << "evento " << e.id << " (" << e.dato << ", " << e.args[0] << ", " << e.args[1] << ")";
+                }
+                salida << '\n';
+            }
+            salida.flush();
+            return eventos.size();
+        }
+
+        // Eventos perdidos porque algún buffer estaba lleno
+        static uint64_t descartados() {
+            Registro &r = registro();
+            lock_guard<mutex> candado(r.candado);
+            uint64_t total = 0;
+            for (auto &b : r.buffers) total += b->descartados.load(memory_order_relaxed);
+            return total;
+        }
+
+        // Hilo en segundo plano que vuelca los eventos cada 'periodo'
+        static void iniciarConsumidor(ostream &salida, chrono::milliseconds periodo = chrono::milliseconds(10)) {
+            Registro &r = registro();
+            if (r.consumidor.joinable()) return;
+            r.detener = false;
+            r.consumidor = thread([&r, &salida, periodo]() {
+                unique_lock<mutex> candado(r.candadoConsumidor);
+                while (!r.senal.wait_for(candado, periodo, [&r]() { return r.detener; })) {
+                    volcar(salida);
+                }
+                volcar(salida);
+            });
+        }
+        static void detenerConsumidor() {
+            Registro &r = registro();
+            if (!r.consumidor.joinable()) return;
+            {
+                lock_guard<mutex> candado(r.candadoConsumidor);
+                r.detener = true;
+            }
+            r.senal.notify_one();
+            r.consumidor.join();
+        }
+
+        /**
+         * Vuelca lo pendiente a cout cuando el programa termina, después de que
+         * se destruyen las variables locales de main().
+         */
+        static void volcarAlSalir() {
+            registro();
+            atexit([]() {
+                detenerConsumidor();
+                volcar(cout);
+            });
+        }
+
+        // Empaqueta hasta 16 caracteres de un texto en dos argumentos
+        static void empaquetar(string_view texto, uint64_t &arg0, uint64_t &arg1) {
+            char bytes[16] = {};
+            memcpy(bytes, texto.data(), min<size_t>(texto.size(), 16));
+            memcpy(&arg0, bytes, 8);
+            memcpy(&arg1, bytes + 8, 8);
+        }
+        static string_view desempaquetar(const EventoTraza &e, char (&bytes)[17]) {
+            memcpy(bytes, e.args, 16);
+            bytes[16] = '\0';
+            return string_view(bytes);
+        }
+    private:
+        struct Formato {
+            const char *nombre = nullptr;
+            FormateadorTraza formateador = nullptr;
+        };
+        struct Registro {
+            mutex candado;
+            vector<unique_ptr<BufferTraza>> buffers;
+            // Buffers de hilos que ya terminaron, quizá con eventos sin volcar
+            vector<BufferTraza *> libres;
+            uint32_t hilos = 0;
+            vector<Formato> formateadores;
+            uint64_t relojInicial = reloj();
+            chrono::steady_clock::time_point tiempoInicial = chrono::steady_clock::now();
+            thread consumidor;
+            mutex candadoConsumidor;
+            condition_variable senal;
+            bool detener = false;
+
+            /**
+             * Los buffers pertenecen al registro (no al hilo), así los eventos de
+             * un hilo que ya terminó aún pueden volcarse. Un hilo nuevo reutiliza
+             * el primer buffer libre que ya se haya volcado por completo; solo si
+             * no hay ninguno se reserva otro.
+             */
+            BufferTraza *tomarBuffer() {
+                lock_guard<mutex> c(candado);
+                uint32_t hilo = hilos++;
+                for (size_t i = 0; i < libres.size(); i++) {
+                    if (!libres[i]->vacio()) continue;
+                    BufferTraza *buffer = libres[i];
+                    libres.erase(libres.begin() + i);
+                    buffer->hilo = hilo;
+                    return buffer;
+                }
+                buffers.emplace_back(new BufferTraza(hilo));
+                return buffers.back().get();
+            }
+            void devolverBuffer(BufferTraza *buffer) {
+                lock_guard<mutex> c(candado);
+                libres.push_back(buffer);
+            }
+            // Convierte una marca del reloj a nanosegundos desde el inicio
+            double nanosegundos(uint64_t marca) {
+                double transcurrido = chrono::duration<double, nano>(chrono::steady_clock::now() - tiempoInicial).count();
+                uint64_t ciclos = reloj() - relojInicial;
+                double nsPorCiclo = ciclos > 0 ? transcurrido / ciclos : 1.0;
+                return (marca - relojInicial) * nsPorCiclo;
+            }
+            ~Registro() {
+                if (consumidor.joinable()) {
+                    {
+                        lock_guard<mutex> c(candadoConsumidor);
+                        detener = true;
+                    }
+                    senal.notify_one();
+                    consumidor.join();
+                }
+            }
+        };
+        static Registro &registro() {
+            static Registro r;
+            return r;
+        }
+        // Devuelve el buffer al registro cuando su hilo termina
+        struct BufferDelHilo {
+            BufferTraza *buffer = registro().tomarBuffer();
+            BufferDelHilo() = default;
+            BufferDelHilo(const BufferDelHilo &) = delete;
+            BufferDelHilo &operator=(const BufferDelHilo &) = delete;
+            ~BufferDelHilo() {
+                registro().devolverBuffer(buffer);
+            }
+        };
+};
+
+#endif
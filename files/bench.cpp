@@ -0,0 +1,116 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <fstream>
+#include <sys/resource.h>
+#include "contador_tokens.h"
+#include "seguimiento.h"
+
+using namespace std;
+
+/**
+ * Benchmark del modo seguir: latencia desde que se escribe una línea hasta que
+ * se entrega, y tiempo de CPU consumido mientras el archivo no cambia.
+ */
+void benchSeguimiento() {
+    string ruta = "/tmp/bench_seguimiento.log";
+    ofstream(ruta, ios::trunc).close();
+    SeguidorArchivo seguidor(ruta);
+
+    const int LINEAS = 2000;
+    vector<double> latencias;
+    thread lector([&]() {
+        seguidor.seguir([&](string_view linea) {
+            // Cada línea trae el instante (ns) en el que se escribió
+            long long escrita = stoll(string(linea));
+            long long ahora = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+            latencias.push_back((ahora - escrita) / 1000.0);
+        });
+    });
+
+    FILE *archivo = fopen(ruta.c_str(), "a");
+    for (int i = 0; i < LINEAS; i++) {
+        long long ahora = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+        fprintf(archivo, "%lld\n", ahora);
+        fflush(archivo);
+        this_thread::sleep_for(chrono::microseconds(500));
+    }
+    fclose(archivo);
+
+    // Midiendo CPU del proceso durante un segundo sin cambios en el archivo
+    this_thread::sleep_for(chrono::milliseconds(50));
+    rusage antes, despues;
+    getrusage(RUSAGE_SELF, &antes);
+    this_thread::sleep_for(chrono::seconds(1));
+    getrusage(RUSAGE_SELF, &despues);
+    double cpuInactivo = (despues.ru_utime.tv_sec - antes.ru_utime.tv_sec + despues.ru_stime.tv_sec - antes.ru_stime.tv_sec) * 1e3
+        + (despues.ru_utime.tv_usec - antes.ru_utime.tv_usec + despues.ru_stime.tv_usec - antes.ru_stime.tv_usec) / 1e3;
+
+    seguidor.despertar();
+    lector.join();
+    remove(ruta.c_str());
+
+    sort(latencias.begin(), latencias.end());
+    cout << "Seguimiento: " << latencias.size() << "/" << LINEAS << " líneas entregadas" << endl;
+    cout << "  Latencia p50: " << latencias[latencias.size() / 2] << " us, p99: "
+         << latencias[latencias.size() * 99 / 100] << " us" << endl;
+    cout << "  CPU en 1 s de inactividad: " << cpuInactivo << " ms" << endl;
+}
+
+/**
+ * Benchmark del contador de palabras contra std::unordered_map<std::string, int>.
+ *
+ * Se genera un corpus sintético de ~64 MB con un vocabulario de 100,000 palabras
+ * distribuidas de forma sesgada (pocas palabras muy frecuentes, muchas raras).
+ */
+int main() {
+
+    mt19937 generador(13);
+    vector<string> vocabulario;
+    uniform_int_distribution<int> longitud(2, 12), letra('a', 'z');
+    for (int i = 0; i < 100000; i++) {
+        string palabra;
+        for (int j = longitud(generador); j > 0; j--) palabra += static_cast<char>(letra(generador));
+        vocabulario.push_back(palabra);
+    }
+
+    string texto;
+    texto.reserve(70 * 1000 * 1000);
+    exponential_distribution<double> sesgo(1.0 / 3000);
+    while (texto.size() < 64 * 1000 * 1000) {
+        size_t indice = static_cast<size_t>(sesgo(generador)) % vocabulario.size();
+        texto += vocabulario[indice];
+        texto += (indice % 7 == 0) ? ".\n" : " ";
+    }
+    double megabytes = texto.size() / 1e6;
+
+    auto medir = [&](const char *nombre, auto funcion) {
+        auto inicio = chrono::steady_clock::now();
+        size_t distintas = funcion();
+        chrono::duration<double> segundos = chrono::steady_clock::now() - inicio;
+        cout << nombre << ": " << megabytes / segundos.count() << " MB/s (" << distintas << " palabras distintas)" << endl;
+    };
+
+    medir("std::unordered_map<string, int>", [&]() {
+        unordered_map<string, int> mapa;
+        tokenizar(texto, [&mapa](const char *p, size_t len) { mapa[string(p, len)]++; });
+        return mapa.size();
+    });
+
+    medir("TablaFrecuencias, 1 hilo", [&]() {
+        return contarTokens(texto, 1).tamanio();
+    });
+
+    unsigned hilos = max(thread::hardware_concurrency(), 1u);
+    string nombre = "TablaFrecuencias, " + to_string(hilos) + " hilos";
+    medir(nombre.c_str(), [&]() {
+        return contarTokens(texto, hilos).tamanio();
+    });
+
+    cout << endl;
+    benchSeguimiento();
+
+    return 0;
+}
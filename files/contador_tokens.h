@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Contador de frecuencia de palabras (tokens) para textos muy grandes.
+ *
+ * Se compone de tres piezas:
+ *   - Un tokenizador que clasifica 16 bytes a la vez con instrucciones SIMD
+ *     (SSE2) para encontrar dónde empieza y termina cada palabra.
+ *   - Una función hash rápida no criptográfica que procesa 8 bytes a la vez.
+ *   - Una tabla hash de direccionamiento abierto al estilo "Swiss table": un
+ *     arreglo de bytes de control (uno por casilla) permite comparar 16
+ *     casillas con una sola instrucción antes de tocar las llaves. Las llaves
+ *     se copian a una arena, por lo que no hay un std::string por palabra.
+ *
+ * Para aprovechar varios núcleos, cada hilo cuenta sobre su propia tabla y al
+ * final las tablas se mezclan en una sola.
+ */
+#ifndef CONTADOR_TOKENS_H
+#define CONTADOR_TOKENS_H
+
+/**
+ * Arena de bytes: reserva bloques grandes y entrega fragmentos de forma
+ * consecutiva. Solo se libera completa, al destruirse.
+ */
+class ArenaBytes {
+    public:
+        const char *copiar(const char *datos, size_t n) {
+            if (n > disponible) {
+                size_t tamanio = max(n, TAMANIO_BLOQUE);
+                bloques.emplace_back(new char[tamanio]);
+                cursor = bloques.back().get();
+                disponible = tamanio;
+            }
+            char *destino = cursor;
+            memcpy(destino, datos, n);
+            cursor += n;
+            disponible -= n;
+            return destino;
+        }
+    private:
+        static constexpr size_t TAMANIO_BLOQUE = 64 * 1024;
+        vector<unique_ptr<char[]>> bloques;
+        char *cursor = nullptr;
+        size_t disponible = 0;
+};
+
+// Hash de 64 bits que consume la llave de 8 en 8 bytes
+inline uint64_t hashRapido(const char *datos, size_t n) {
+    const uint64_t k = 0x9E3779B97F4A7C15ULL;
+    uint64_t h = n * k;
+    while (n >= 8) {
+        uint64_t palabra;
+        memcpy(&palabra, datos, 8);
+        h = (h ^ palabra) * k;
+        h ^= h >> 29;
+        datos += 8;
+        n -= 8;
+    }
+    if (n > 0) {
+        uint64_t resto = 0;
+        memcpy(&resto, datos, n);
+        h = (h ^ resto) * k;
+    }
+    // Finalizador de MurmurHash3 para mezclar bien todos los bits
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Tabla de frecuencias de direccionamiento abierto.
+ *
+ * Cada casilla tiene un byte de control: 0x80 si está vacía, o bien los 7 bits
+ * bajos del hash (H2) si está ocupada. Los bits altos del hash (H1) eligen el
+ * grupo de 16 casillas donde empieza la búsqueda; si no se encuentra la llave
+ * ni una casilla vacía se prueba el siguiente grupo (sondeo cuadrático).
+ */
+class TablaFrecuencias {
+    public:
+        struct Entrada {
+            const char *llave;
+            uint32_t longitud;
+            uint64_t hash;
+            uint64_t cuenta;
+        };
+
+        TablaFrecuencias(size_t capacidadInicial = 1024) {
+            size_t capacidad = GRUPO;
+            while (capacidad < capacidadInicial) capacidad *= 2;
+            this->reservar(capacidad);
+        }
+
+        void incrementar(string_view llave, uint64_t n = 1) {
+            this->sumar(llave.data(), llave.size(), hashRapido(llave.data(), llave.size()), n);
+        }
+
+        void sumar(const char *llave, size_t longitud, uint64_t hash, uint64_t n) {
+            size_t casilla;
+            if (this->buscar(llave, longitud, hash, casilla)) {
+                entradas[casilla].cuenta += n;
+                return;
+            }
+            // Manteniendo el factor de carga por debajo de 7/8
+            if ((ocupadas + 1) * 8 > control.size() * 7) {
+                this->crecer();
+                this->buscar(llave, longitud, hash, casilla);
+            }
+            control[casilla] = h2(hash);
+            entradas[casilla] = { arena.copiar(llave, longitud), static_cast<uint32_t>(longitud), hash, n };
+            ocupadas++;
+        }
+
+        uint64_t cuenta(string_view llave) const {
+            size_t casilla;
+            uint64_t hash = hashRapido(llave.data(), llave.size());
+            return this->buscar(llave.data(), llave.size(), hash, casilla) ? entradas[casilla].cuenta : 0;
+        }
+
+        // Suma las cuentas de otra tabla a esta, reutilizando los hashes ya calculados
+        void mezclar(const TablaFrecuencias &otra) {
+            otra.paraCada([this](const Entrada &e) {
+                this->sumar(e.llave, e.longitud, e.hash, e.cuenta);
+            });
+        }
+
+        template <typename Funcion>
+        void paraCada(Funcion f) const {
+            for (size_t i = 0; i < control.size(); i++) {
+                if (control[i] != VACIA) f(entradas[i]);
+            }
+        }
+
+        size_t tamanio() const {
+            return ocupadas;
+        }
+    private:
+        static constexpr size_t GRUPO = 16;
+        static constexpr uint8_t VACIA = 0x80;
+        vector<uint8_t> control;
+        vector<Entrada> entradas;
+        size_t ocupadas = 0;
+        ArenaBytes arena;
+
+        static uint8_t h2(uint64_t hash) {
+            return hash & 0x7F;
+        }
+
+        void reservar(size_t capacidad) {
+            control.assign(capacidad, VACIA);
+            entradas.assign(capacidad, Entrada());
+            ocupadas = 0;
+        }
+
+        // Máscara de bits de las casillas del grupo cuyo byte de control es 'byte'
+        uint32_t coincidencias(size_t grupo, uint8_t byte) const {
+#if defined(__SSE2__)
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&control[grupo]));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(byte))));
+#else
+            uint32_t mascara = 0;
+            for (size_t i = 0; i < GRUPO; i++) {
+                if (control[grupo + i] == byte) mascara |= 1u << i;
+            }
+            return mascara;
+#endif
+        }
+
+        /**
+         * Busca la llave. Si existe regresa true y su casilla; si no, regresa
+         * false y la primera casilla vacía donde debería insertarse.
+         */
+        bool buscar(const char *llave, size_t longitud, uint64_t hash, size_t &casilla) const {
+            size_t mascaraGrupos = control.size() / GRUPO - 1;
+            size_t grupo = (hash >> 7) & mascaraGrupos;
+            uint8_t etiqueta = h2(hash);
+            for (size_t salto = 1; ; salto++) {
+                size_t base = grupo * GRUPO;
+                for (uint32_t m = this->coincidencias(base, etiqueta); m != 0; m &= m - 1) {
+                    size_t i = base + __builtin_ctz(m);
+                    const Entrada &e = entradas[i];
+                    if (e.hash == hash && e.longitud == longitud && memcmp(e.llave, llave, longitud) == 0) {
+                        casilla = i;
+                        return true;
+                    }
+                }
+                uint32_t vacias = this->coincidencias(base, VACIA);
+                if (vacias != 0) {
+                    casilla = base + __builtin_ctz(vacias);
+                    return false;
+                }
+                grupo = (grupo + salto) & mascaraGrupos;
+            }
+        }
+
+        void crecer() {
+            vector<uint8_t> controlAnterior;
+            vector<Entrada> entradasAnteriores;
+            controlAnterior.swap(control);
+            entradasAnteriores.swap(entradas);
+            this->reservar(controlAnterior.size() * 2);
+            for (size_t i = 0; i < controlAnterior.size(); i++) {
+                if (controlAnterior[i] == VACIA) continue;
+                const Entrada &e = entradasAnteriores[i];
+                size_t casilla;
+                this->buscar(e.llave, e.longitud, e.hash, casilla);
+                control[casilla] = h2(e.hash);
+                entradas[casilla] = e; // La llave sigue viviendo en la arena
+                ocupadas++;
+            }
+        }
+};
+
+// Un byte forma parte de una palabra si es letra, dígito o parte de un caracter UTF-8
+inline bool esCaracterToken(unsigned char c) {
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c >= 0x80;
+}
+
+/**
+ * Clasifica 16 bytes a la vez y devuelve una máscara donde el bit i está
+ * encendido si datos[i] forma parte de una palabra.
+ */
+inline uint32_t mascaraTokens16(const char *datos) {
+#if defined(__SSE2__)
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(datos));
+    // Los bytes >= 0x80 son negativos al compararse con signo
+    __m128i utf8 = _mm_cmplt_epi8(bytes, _mm_setzero_si128());
+    __m128i digitos = _mm_and_si128(
+        _mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+        _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1))
+    );
+    __m128i minusculas = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+    __m128i letras = _mm_and_si128(
+        _mm_cmpgt_epi8(minusculas, _mm_set1_epi8('a' - 1)),
+        _mm_cmplt_epi8(minusculas, _mm_set1_epi8('z' + 1))
+    );
+    return _mm_movemask_epi8(_mm_or_si128(utf8, _mm_or_si128(digitos, letras)));
+#else
+    uint32_t mascara = 0;
+    for (int i = 0; i < 16; i++) {
+        if (esCaracterToken(datos[i])) mascara |= 1u << i;
+    }
+    return mascara;
+#endif
+}
+
+/**
+ * Recorre el texto e invoca f(inicio, longitud) por cada palabra. Se procesan
+ * bloques de 64 bytes: primero se construye la máscara completa del bloque y
+ * después se salta de borde en borde contando ceros finales (ctz).
+ */
+template <typename Funcion>
+void tokenizar(string_view texto, Funcion f) {
+    const char *datos = texto.data();
+    size_t n = texto.size();
+    size_t inicioToken = 0;
+    bool dentro = false;
+    size_t base = 0;
+    for (; base + 64 <= n; base += 64) {
+        uint64_t mascara = 0;
+        for (int i = 0; i < 4; i++) {
+            mascara |= static_cast<uint64_t>(mascaraTokens16(datos + base + i * 16)) << (i * 16);
+        }
+        size_t bit = 0;
+        while (bit < 64) {
+            // Saltando hasta el siguiente cambio entre separador y palabra
+            uint64_t resto = (dentro ? ~mascara : mascara) >> bit;
+            if (resto == 0) break;
+            bit += __builtin_ctzll(resto);
+            if (dentro) {
+                f(datos + inicioToken, base + bit - inicioToken);
+            } else {
+                inicioToken = base + bit;
+            }
+            dentro = !dentro;
+        }
+    }
+    // Bytes finales que no completan un bloque de 64
+    for (size_t i = base; i < n; i++) {
+        bool esToken = esCaracterToken(datos[i]);
+        if (esToken && !dentro) inicioToken = i;
+        if (!esToken && dentro) f(datos + inicioToken, i - inicioToken);
+        dentro = esToken;
+    }
+    if (dentro) f(datos + inicioToken, n - inicioToken);
+}
+
+/**
+ * Cuenta la frecuencia de cada palabra usando 'hilos' tablas independientes.
+ * El texto se parte en trozos cuyos bordes caen siempre en un separador, para
+ * que ninguna palabra quede dividida entre dos hilos.
+ */
+inline TablaFrecuencias contarTokens(string_view texto, unsigned hilos = thread::hardware_concurrency()) {
+    hilos = max(hilos, 1u);
+    vector<size_t> cortes = { 0 };
+    for (unsigned i = 1; i < hilos; i++) {
+        size_t corte = max(texto.size() * i / hilos, cortes.back());
+        while (corte < texto.size() && esCaracterToken(texto[corte])) corte++;
+        cortes.push_back(corte);
+    }
+    cortes.push_back(texto.size());
+
+    vector<TablaFrecuencias> tablas(hilos);
+    vector<thread> trabajadores;
+    for (unsigned i = 0; i < hilos; i++) {
+        trabajadores.emplace_back([&, i]() {
+            TablaFrecuencias &tabla = tablas[i];
+            tokenizar(texto.substr(cortes[i], cortes[i + 1] - cortes[i]), [&tabla](const char *p, size_t len) {
+                tabla.sumar(p, len, hashRapido(p, len), 1);
+            });
+        });
+    }
+    for (thread &t : trabajadores) t.join();
+
+    for (unsigned i = 1; i < hilos; i++) tablas[0].mezclar(tablas[i]);
+    return move(tablas[0]);
+}
+
+#endif
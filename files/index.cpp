@@ -8,6 +8,17 @@
  * en lo posible manipular más de un archivo a la vez.
  */
 #include <fstream>
+#include <sstream>
+/**
+ * Contador de frecuencia de palabras para textos muy grandes.
+ */
+#include "contador_tokens.h"
+/**
+ * Modo seguir (tail -f) para archivos que siguen creciendo.
+ */
+#include "seguimiento.h"
+#include <chrono>
+#include <thread>
 
 using namespace std;
 
@@ -74,6 +85,61 @@ int main() {
         cout << line1 << endl;
         cout << line2 << endl;
     }
+
+    MyFileB.close();
+
+    /**
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     * --------------------------------- Frecuencia de palabras ---------------------------------------
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     *
+     * En lugar de solo repetir las líneas leídas, el contenido completo del archivo
+     * se carga en un string (rdbuf) y se cuenta cuántas veces aparece cada palabra.
+     */
+    ifstream MyFileC("nombre_archivo.txt");
+
+    if (MyFileC.is_open()) {
+        stringstream contenido;
+        contenido << MyFileC.rdbuf();
+        string texto = contenido.str();
+
+        TablaFrecuencias frecuencias = contarTokens(texto);
+        frecuencias.paraCada([](const TablaFrecuencias::Entrada &e) {
+            cout << string_view(e.llave, e.longitud) << ": " << e.cuenta << endl;
+        });
+    }
+
+    MyFileC.close();
+
+    /**
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     * -------------------------------- Seguimiento de archivos ---------------------------------------
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     *
+     * Un archivo de log puede seguir creciendo mientras se lee. SeguidorArchivo
+     * recuerda hasta qué byte se leyó y se duerme hasta que el archivo cambie.
+     * En este ejemplo, otro hilo agrega líneas al archivo mientras se sigue.
+     */
+    SeguidorArchivo seguidor("nombre_archivo.txt", true);
+
+    thread escritor([]() {
+        for (int i = 1; i <= 3; i++) {
+            this_thread::sleep_for(chrono::milliseconds(100));
+            ofstream MyFileD("nombre_archivo.txt", ios::app);
+            MyFileD << "Línea agregada #" << i << endl;
+        }
+    });
+
+    size_t recibidas = 0;
+    while (recibidas < 3) {
+        // Solo se leen los bytes agregados desde la última lectura
+        recibidas += seguidor.leerNuevos([](string_view linea) {
+            cout << "Nueva línea: " << linea << endl;
+        });
+        // Durmiendo sin consumir CPU hasta que el archivo cambie
+        if (recibidas < 3) seguidor.esperar(1000);
+    }
+    escritor.join();
  
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+/**
+ * Modo "seguir" (como tail -f) para archivos que siguen creciendo.
+ *
+ * En lugar de volver a abrir el archivo y leerlo desde el inicio cada vez, se
+ * recuerda el último byte consumido y solo se leen los bytes nuevos. Para no
+ * gastar CPU revisando el archivo una y otra vez, el hilo se duerme en poll()
+ * hasta que inotify (API de Linux) avisa que el archivo fue modificado.
+ *
+ * También se contemplan dos casos típicos de los archivos de log:
+ *   - Truncado: el archivo se vuelve más pequeño que la posición guardada, por
+ *     lo que se continúa desde el byte 0.
+ *   - Rotación: el archivo se renombra o elimina y se crea uno nuevo con el
+ *     mismo nombre. Se terminan de leer los bytes del archivo anterior y se
+ *     abre el nuevo desde el inicio.
+ *
+ * En ambos casos, si el contenido anterior terminaba sin salto de línea, ese
+ * último fragmento se entrega como una línea más antes de continuar: el
+ * resto ya no va a llegar.
+ */
+#ifndef SEGUIMIENTO_H
+#define SEGUIMIENTO_H
+
+class SeguidorArchivo {
+    public:
+        /**
+         * Si 'desdeElFinal' es true se ignora el contenido que ya existe y solo
+         * se entregan las líneas agregadas después de abrir el archivo.
+         */
+        SeguidorArchivo(const string &ruta, bool desdeElFinal = false) {
+            this->ruta = ruta;
+            size_t separador = ruta.find_last_of('/');
+            this->directorio = separador == string::npos ? "." : ruta.substr(0, separador == 0 ? 1 : separador);
+
+            this->inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            this->despertarFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (inotifyFd < 0 || despertarFd < 0) {
+                throw runtime_error("No se pudo inicializar inotify");
+            }
+            // El directorio avisa cuando aparece un archivo nuevo con el mismo nombre (rotación)
+            this->directorioWd = inotify_add_watch(inotifyFd, directorio.c_str(), IN_CREATE | IN_MOVED_TO);
+            this->abrir();
+            if (desdeElFinal && fd >= 0) {
+                struct stat info;
+                if (fstat(fd, &info) == 0) this->posicion = info.st_size;
+            }
+        }
+        ~SeguidorArchivo() {
+            if (fd >= 0) close(fd);
+            close(inotifyFd);
+            close(despertarFd);
+        }
+        SeguidorArchivo(const SeguidorArchivo &) = delete;
+        SeguidorArchivo &operator=(const SeguidorArchivo &) = delete;
+
+        // Último byte consumido del archivo actual
+        uint64_t offset() const {
+            return posicion;
+        }
+
+        /**
+         * Lee únicamente los bytes nuevos e invoca f(línea) por cada línea
+         * completa. Una línea sin salto final se guarda hasta que llegue el resto.
+         * Regresa la cantidad de líneas entregadas.
+         */
+        template <typename Funcion>
+        size_t leerNuevos(Funcion f) {
+            size_t lineas = 0;
+            if (fd < 0) this->abrir();
+            if (fd < 0) return 0;
+
+            struct stat info;
+            if (fstat(fd, &info) == 0 && static_cast<uint64_t>(info.st_size) < posicion) {
+                // Truncado: lo que había pendiente ya no va a completarse
+                lineas += this->entregarPendiente(f);
+                posicion = 0;
+            }
+            lineas += this->leerHastaElFinal(f);
+
+            // Rotación: la ruta ahora apunta a otro archivo (o a ninguno)
+            struct stat actual;
+            bool existe = stat(ruta.c_str(), &actual) == 0;
+            if (!existe || actual.st_ino != inodo || actual.st_dev != dispositivo) {
+                lineas += this->leerHastaElFinal(f);
+                lineas += this->entregarPendiente(f);
+                close(fd);
+                fd = -1;
+                if (archivoWd >= 0) inotify_rm_watch(inotifyFd, archivoWd);
+                archivoWd = -1;
+                posicion = 0;
+                if (existe) {
+                    this->abrir();
+                    lineas += this->leerHastaElFinal(f);
+                }
+            }
+            return lineas;
+        }
+
+        /**
+         * Duerme hasta que inotify reporte cambios, se llame a despertar() o pase
+         * 'tiempoMs' (-1 = sin límite). Mientras espera no consume CPU.
+         * Regresa false si fue despertado con despertar().
+         */
+        bool esperar(int tiempoMs = -1) {
+            pollfd fds[2] = { { inotifyFd, POLLIN, 0 }, { despertarFd, POLLIN, 0 } };
+            int r = poll(fds, 2, tiempoMs);
+            if (r < 0 && errno != EINTR) throw runtime_error("Error en poll()");
+            // Descartando los eventos; solo interesa que algo cambió
+            char eventos[4096] __attribute__((aligned(__alignof__(inotify_event))));
+            while (read(inotifyFd, eventos, sizeof(eventos)) > 0) {}
+            if (fds[1].revents & POLLIN) {
+                uint64_t valor;
+                if (read(despertarFd, &valor, sizeof(valor)) < 0) {}
+                return false;
+            }
+            return true;
+        }
+
+        // Despierta a un hilo bloqueado en esperar() o seguir(), p. ej. para detenerlo
+        void despertar() {
+            uint64_t uno = 1;
+            if (write(despertarFd, &uno, sizeof(uno)) < 0) {}
+        }
+
+        /**
+         * Bucle principal: entrega las líneas nuevas conforme aparecen hasta que
+         * se invoque despertar() desde otro hilo.
+         */
+        template <typename Funcion>
+        void seguir(Funcion f) {
+            do {
+                this->leerNuevos(f);
+            } while (this->esperar());
+        }
+    private:
+        string ruta, directorio;
+        int fd = -1;
+        int inotifyFd = -1, despertarFd = -1;
+        int archivoWd = -1, directorioWd = -1;
+        ino_t inodo = 0;
+        dev_t dispositivo = 0;
+        uint64_t posicion = 0;
+        string pendiente;
+
+        void abrir() {
+            fd = open(ruta.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return;
+            struct stat info;
+            fstat(fd, &info);
+            inodo = info.st_ino;
+            dispositivo = info.st_dev;
+            archivoWd = inotify_add_watch(inotifyFd, ruta.c_str(), IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+        }
+
+        template <typename Funcion>
+        size_t leerHastaElFinal(Funcion &f) {
+            size_t lineas = 0;
+            char buffer[64 * 1024];
+            while (true) {
+                ssize_t n = pread(fd, buffer, sizeof(buffer), posicion);
+                if (n <= 0) break;
+                posicion += n;
+                string_view bloque(buffer, n);
+                size_t inicio = 0, salto;
+                while ((salto = bloque.find('\n', inicio)) != string_view::npos) {
+                    if (pendiente.empty()) {
+                        f(bloque.substr(inicio, salto - inicio));
+                    } else {
+                        pendiente.append(bloque.substr(inicio, salto - inicio));
+                        f(string_view(pendiente));
+                        pendiente.clear();
+                    }
+                    lineas++;
+                    inicio = salto + 1;
+                }
+                pendiente.append(bloque.substr(inicio));
+            }
+            return lineas;
+        }
+
+        // La última línea de un archivo que ya no va a crecer, aunque no termine en salto
+        template <typename Funcion>
+        size_t entregarPendiente(Funcion &f) {
+            if (pendiente.empty()) return 0;
+            f(string_view(pendiente));
+            pendiente.clear();
+            return 1;
+        }
+};
+
+#endif
@@ -0,0 +1,169 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "lotes.h"
+#include "potencia.h"
+
+using namespace std;
+
+// El mejor de varios intentos: descarta las interrupciones de otros procesos
+template <typename Funcion>
+double medirMs(Funcion f, int repeticiones) {
+    double mejor = 1e300;
+    for (int r = 0; r < repeticiones; r++) {
+        auto inicio = chrono::steady_clock::now();
+        f();
+        mejor = min(mejor, chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count());
+    }
+    return mejor;
+}
+
+// Mayor diferencia relativa contra std::pow
+template <typename T>
+double errorRelativo(const vector<T> &x, const vector<T> &esperado) {
+    double peor = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        if (esperado[i] != 0) peor = max(peor, fabs((double(x[i]) - esperado[i]) / esperado[i]));
+    }
+    return peor;
+}
+
+/**
+ * std::pow contra potencia<N>() (exponente al compilar), potenciaReal()
+ * (exponente en una variable, un elemento a la vez) y potencias() en lote.
+ */
+void benchPotencias() {
+    const size_t N = 10 * 1000 * 1000;
+    const int REPETICIONES = 5;
+    // volatile: que el compilador no conozca el exponente
+    volatile int exponenteVariable = 13;
+    int e = exponenteVariable;
+
+    vector<double> x(N), conPow(N), resultado(N);
+    for (size_t i = 0; i < N; i++) x[i] = 0.5 + double(i % 1000) / 1000;
+
+    cout << "Caso\t\t\t\tstd::pow (ms)\tpotencia (ms)\tEn lote (ms)\tError relativo" << endl;
+    // Un tiempo negativo es un caso que no aplica
+    auto reportar = [](const char *caso, double pow, double escalar, double lote, double error) {
+        cout << caso << "\t" << pow << "\t\t";
+        if (escalar < 0) cout << "-"; else cout << escalar;
+        cout << "\t\t";
+        if (lote < 0) cout << "-"; else cout << lote;
+        cout << "\t\t" << error << endl;
+    };
+
+    double p = medirMs([&]() {
+        for (size_t i = 0; i < N; i++) conPow[i] = pow(x[i], 3);
+    }, REPETICIONES);
+    double s = medirMs([&]() {
+        for (size_t i = 0; i < N; i++) resultado[i] = potencia<3>(x[i]);
+    }, REPETICIONES);
+    double l = medirMs([&]() { potencias<3>(x.data(), resultado.data(), N); }, REPETICIONES);
+    reportar("x^3 (exponente al compilar)", p, s, l, errorRelativo(resultado, conPow));
+
+    p = medirMs([&]() {
+        for (size_t i = 0; i < N; i++) conPow[i] = pow(x[i], e);
+    }, REPETICIONES);
+    s = medirMs([&]() {
+        for (size_t i = 0; i < N; i++) resultado[i] = potenciaReal(x[i], e);
+    }, REPETICIONES);
+    l = medirMs([&]() { potencias(x.data(), resultado.data(), N, e); }, REPETICIONES);
+    reportar("x^13 (exponente en variable)", p, s, l, errorRelativo(resultado, conPow));
+
+    p = medirMs([&]() {
+        for (size_t i = 0; i < N; i++) conPow[i] = pow(x[i], -e);
+    }, REPETICIONES);
+    l = medirMs([&]() { potencias(x.data(), resultado.data(), N, -e); }, REPETICIONES);
+    reportar("x^-13\t\t\t", p, -1, l, errorRelativo(resultado, conPow));
+
+    vector<float> xf(x.begin(), x.end()), conPowf(N), resultadof(N);
+    p = medirMs([&]() {
+        for (size_t i = 0; i < N; i++) conPowf[i] = powf(xf[i], float(e));
+    }, REPETICIONES);
+    l = medirMs([&]() { potencias(xf.data(), resultadof.data(), N, e); }, REPETICIONES);
+    reportar("x^13 en float (powf)\t", p, -1, l, errorRelativo(resultadof, conPowf));
+
+    // Enteros: pow() pasa por double y se redondea de vuelta
+    vector<long> bases(N);
+    for (size_t i = 0; i < N; i++) bases[i] = long(i % 29) - 14;
+    long suma1 = 0, suma2 = 0;
+    p = medirMs([&]() {
+        suma1 = 0;
+        for (size_t i = 0; i < N; i++) suma1 += long(pow(bases[i], e));
+    }, REPETICIONES);
+    s = medirMs([&]() {
+        suma2 = 0;
+        for (size_t i = 0; i < N; i++) suma2 += potenciaEntera(bases[i], e);
+    }, REPETICIONES);
+    reportar("Enteros, base^13 con revisión", p, s, -1, suma1 == suma2 ? 0 : 1);
+}
+
+/**
+ * Cada versión de los lotes, del ciclo escalar a AVX-512, sobre arreglos de
+ * 2048 + 13 elementos (caben en la caché L1) recorridos muchas veces: así se
+ * mide el cómputo y no el ancho de banda de la memoria. Los 13 de más no
+ * llenan un registro, de modo que también corren las colas de cada versión
+ * (escalares en SSE y AVX2, con máscara en AVX-512). Los cuatro resultados se
+ * comparan con los de la versión genérica; una diferencia se marca con (!).
+ */
+void benchLotes() {
+    const size_t N = 2048 + 13;
+    const int VUELTAS = 80000;
+    vector<int> a(N), b(N), r(N), sumaReferencia(N), dobleReferencia(N);
+    vector<float> originales(N), valores(N), divisionReferencia(N);
+    bool impares[N], imparesReferencia[N];
+    for (size_t i = 0; i < N; i++) {
+        a[i] = int(i * 2654435761u);
+        b[i] = int(i * 40503u);
+        originales[i] = float(i) + 0.25f;
+    }
+    TablaLotes generica = tablaParaNivel(NivelSimd::GENERICO);
+    generica.sumar(a.data(), b.data(), sumaReferencia.data(), N);
+    generica.doblar(a.data(), dobleReferencia.data(), N, 3);
+    generica.esImpar(a.data(), imparesReferencia, N);
+    divisionReferencia = originales;
+    generica.dividir(divisionReferencia.data(), N);
+
+    cout << "Nivel detectado: " << nombreNivel(detectarNivelSimd()) << " (" << VUELTAS << " x " << N << " elementos)" << endl;
+    cout << "Versión		sumar (ms)	doblar (ms)	esImpar (ms)	dividir (ms)" << endl;
+    auto marca = [](bool iguales) { return iguales ? "" : " (!)"; };
+    for (int nivel = 0; nivel <= int(detectarNivelSimd()); nivel++) {
+        TablaLotes tabla = tablaParaNivel(NivelSimd(nivel));
+        double sumar = medirMs([&]() {
+            for (int v = 0; v < VUELTAS; v++) tabla.sumar(a.data(), b.data(), r.data(), N);
+        }, 3);
+        bool sumaIgual = r == sumaReferencia;
+        double doblar = medirMs([&]() {
+            for (int v = 0; v < VUELTAS; v++) tabla.doblar(a.data(), r.data(), N, 3);
+        }, 3);
+        bool dobleIgual = r == dobleReferencia;
+        double esImpar = medirMs([&]() {
+            for (int v = 0; v < VUELTAS; v++) tabla.esImpar(a.data(), impares, N);
+        }, 3);
+        bool imparesIgual = equal(impares, impares + N, imparesReferencia);
+        // Cada 100 divisiones se restauran los valores, antes de llegar a subnormales (mucho más lentos)
+        double dividir = medirMs([&]() {
+            for (int v = 0; v < VUELTAS; v++) {
+                if (v % 100 == 0) copy(originales.begin(), originales.end(), valores.begin());
+                tabla.dividir(valores.data(), N);
+            }
+        }, 3);
+        // Una sola división desde los originales, para comparar
+        valores = originales;
+        tabla.dividir(valores.data(), N);
+        bool divisionIgual = valores == divisionReferencia;
+        cout << nombreNivel(tabla.nivel) << (tabla.nivel == NivelSimd::GENERICO ? "\t" : "\t\t") << sumar << marca(sumaIgual) << "\t\t"
+             << doblar << marca(dobleIgual) << "\t\t" << esImpar << marca(imparesIgual) << "\t\t" << dividir << marca(divisionIgual) << endl;
+    }
+}
+
+int main() {
+
+    benchPotencias();
+    cout << endl;
+    benchLotes();
+
+    return 0;
+}
@@ -1,4 +1,15 @@
+#include <climits>
+#include <cmath>
 #include <iostream>
+/**
+ * Potencias con exponente entero: exponenciación binaria, en compilación y en lote.
+ */
+#include "potencia.h"
+/**
+ * sumar(), doblar(), esImpar() y dividir() sobre arreglos completos, con la
+ * versión SIMD que soporte el procesador.
+ */
+#include "lotes.h"
 
 using namespace std;
 
@@ -68,6 +79,47 @@ int main() {
     // Invocando método con parámetro opcional
     cout << "Número 5 doblado a razón de 2: " << doblar(5) << endl;
 
+    // Invocando cada sobrecarga: el compilador elige según los parámetros
+    cout << "12 al cuadrado: " << potencia(12) << endl;
+    cout << "¿0.125 es potencia de 2?: " << potencia(0.125) << endl;
+    cout << "3 elevado a 20: " << potencia(3, 20) << endl;
+    try {
+        long grande = potencia(3, 40);
+        cout << "3 elevado a 40: " << grande << endl;
+    } catch (const overflow_error &e) {
+        cout << "3 elevado a 40: " << e.what() << endl;
+    }
+
+    /**
+     * Con exponente conocido al compilar, potencia<N>() se resuelve en
+     * multiplicaciones y, con argumentos constantes, el resultado completo es
+     * una constante.
+     */
+    constexpr long kilobytesEnGigabyte = potencia<2>(1024L);
+    double radio = 1.5;
+    cout << "KiB en un GiB: " << kilobytesEnGigabyte << ", radio al cubo: " << potencia<3>(radio) << endl;
+    cout << "2^100 mod (10^9 + 7): " << potenciaModular(2, 100, 1000000007) << endl;
+    double bases[] = { 0.5, 1.5, 2, 3, -2 }, cubos[5];
+    potencias(bases, cubos, 5, 3);
+    cout << "Cubos en lote:";
+    for (double cubo : cubos) cout << " " << cubo;
+    cout << endl;
+
+    /**
+     * Las versiones en lote reciben arreglos completos. La primera llamada
+     * consulta al procesador qué instrucciones tiene y elige la mejor versión
+     * de cada función; el mismo ejecutable corre en cualquier x86-64.
+     */
+    int numeros[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }, otros[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90, 100 }, sumas[10];
+    bool impares[10];
+    float mitades[] = { 8.8, 1, 3 };
+    sumarLote(numeros, otros, sumas, 10);
+    doblarLote(numeros, numeros, 10);
+    esImparLote(otros, impares, 10);
+    dividirLote(mitades, 3);
+    cout << "Lotes con " << nombreNivel(tablaLotes().nivel) << ": suma[9] = " << sumas[9] << ", doble de 10 = " << numeros[9]
+         << ", ¿80 es impar? " << impares[7] << ", mitad de 8.8 = " << mitades[0] << endl;
+
     return 0;
 }
 
@@ -99,4 +151,24 @@ void dividir(float &ref) {
 // Procedimiento para reemplazar un número por 100
 void reemplazar(int *puntero) {
     *puntero = 100;
+}
+
+// Método para elevar un número al cuadrado; el resultado debe caber en un short
+short potencia(int numero) {
+    long cuadrado = potenciaEntera<long>(numero, 2);
+    if (cuadrado > SHRT_MAX) throw overflow_error("El cuadrado no cabe en un short");
+    return cuadrado;
+}
+
+// Método para resolver si un número es una potencia exacta de 2 (..., 0.5, 1, 2, 4, ...)
+bool potencia(double numero) {
+    int exponente;
+    // frexp() separa numero = mantisa * 2^exponente, con la mantisa en [0.5, 1)
+    return numero > 0 && frexp(numero, &exponente) == 0.5;
+}
+
+// Método para elevar una base a un exponente no negativo, sin desbordar en silencio
+long potencia(int base, int exponente) {
+    if (exponente < 0) throw invalid_argument("El exponente debe ser positivo o cero");
+    return potenciaEntera<long>(base, exponente);
 }
\ No newline at end of file
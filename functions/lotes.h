@@ -0,0 +1,284 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define LOTES_X86
+#endif
+
+using namespace std;
+
+/**
+ * Versiones en lote de sumar(), doblar(), esImpar() y dividir(), con
+ * selección de instrucciones al ejecutar.
+ *
+ * Compilado con "g++ -Wall -Wextra", sin -mavx2 ni -march, el programa solo
+ * puede suponer SSE2, porque debe correr en cualquier x86-64. Cada función se
+ * escribe aquí varias veces con __attribute__((target(...))), que le permite
+ * al compilador usar instrucciones más nuevas solo dentro de esa función:
+ *
+ *   GENERICO  ciclo escalar                     1 elemento por vuelta
+ *   SSE42     registros de 128 bits (SSE4.1/4.2) 4 int o 4 float
+ *   AVX2      registros de 256 bits              8
+ *   AVX512    registros de 512 bits con máscaras 16
+ *
+ * Al primer uso se consulta el procesador con cpuid y se llena una tabla de
+ * punteros a función con la mejor versión disponible (lo mismo que hace un
+ * ifunc del enlazador); después, cada llamada es un salto indirecto.
+ *
+ * Los enteros dan la vuelta al desbordar, como las instrucciones SIMD, en
+ * lugar de ser comportamiento indefinido como en sumar().
+ */
+#ifndef LOTES_H
+#define LOTES_H
+
+enum class NivelSimd { GENERICO, SSE42, AVX2, AVX512 };
+
+inline const char *nombreNivel(NivelSimd nivel) {
+    switch (nivel) {
+        case NivelSimd::GENERICO: return "genérico";
+        case NivelSimd::SSE42: return "SSE4.2";
+        case NivelSimd::AVX2: return "AVX2";
+        case NivelSimd::AVX512: return "AVX-512";
+    }
+    return "desconocido";
+}
+
+#if defined(LOTES_X86)
+// Registros que el sistema operativo guarda al cambiar de hilo (XCR0)
+inline uint64_t leerXcr0() {
+    uint32_t bajo, alto;
+    __asm__("xgetbv" : "=a"(bajo), "=d"(alto) : "c"(0));
+    return uint64_t(alto) << 32 | bajo;
+}
+#endif
+
+/**
+ * Que el procesador tenga AVX no basta: el sistema operativo también debe
+ * guardar los registros de 256 y 512 bits (bits 1-2 y 5-7 de XCR0), o se
+ * corromperían entre hilos.
+ */
+inline NivelSimd detectarNivelSimd() {
+#if defined(LOTES_X86)
+    unsigned a, b, c, d;
+    if (!__get_cpuid(1, &a, &b, &c, &d) || !(c & bit_SSE4_1) || !(c & bit_SSE4_2)) return NivelSimd::GENERICO;
+    if (!(c & bit_OSXSAVE) || !(c & bit_AVX)) return NivelSimd::SSE42;
+    uint64_t xcr0 = leerXcr0();
+    if ((xcr0 & 0x6) != 0x6 || __get_cpuid_max(0, nullptr) < 7) return NivelSimd::SSE42;
+    __cpuid_count(7, 0, a, b, c, d);
+    if (!(b & bit_AVX2)) return NivelSimd::SSE42;
+    if ((b & bit_AVX512F) && (xcr0 & 0xE6) == 0xE6) return NivelSimd::AVX512;
+    return NivelSimd::AVX2;
+#else
+    return NivelSimd::GENERICO;
+#endif
+}
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * ----------------------------------------- Genéricos --------------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ */
+
+inline void sumarLoteGenerico(const int *a, const int *b, int *resultados, size_t n) {
+    for (size_t i = 0; i < n; i++) resultados[i] = int(unsigned(a[i]) + unsigned(b[i]));
+}
+inline void doblarLoteGenerico(const int *numeros, int *resultados, size_t n, int razon) {
+    for (size_t i = 0; i < n; i++) resultados[i] = int(unsigned(numeros[i]) * unsigned(razon));
+}
+inline void esImparLoteGenerico(const int *numeros, bool *resultados, size_t n) {
+    for (size_t i = 0; i < n; i++) resultados[i] = (numeros[i] & 1) != 0;
+}
+inline void dividirLoteGenerico(float *valores, size_t n) {
+    for (size_t i = 0; i < n; i++) valores[i] = valores[i] / 2.0f;
+}
+
+#if defined(LOTES_X86)
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * ------------------------------------------ SSE4.2 ----------------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ *
+ * Los elementos que no llenan un registro se terminan con la versión genérica.
+ */
+
+__attribute__((target("sse4.2"))) inline void sumarLoteSse42(const int *a, const int *b, int *resultados, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(resultados + i), _mm_add_epi32(x, y));
+    }
+    sumarLoteGenerico(a + i, b + i, resultados + i, n - i);
+}
+__attribute__((target("sse4.2"))) inline void doblarLoteSse42(const int *numeros, int *resultados, size_t n, int razon) {
+    size_t i = 0;
+    __m128i r = _mm_set1_epi32(razon);
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(numeros + i));
+        // Multiplicación de 32 bits por carril: llegó con SSE4.1
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(resultados + i), _mm_mullo_epi32(x, r));
+    }
+    doblarLoteGenerico(numeros + i, resultados + i, n - i, razon);
+}
+__attribute__((target("sse4.2"))) inline void esImparLoteSse42(const int *numeros, bool *resultados, size_t n) {
+    size_t i = 0;
+    __m128i uno = _mm_set1_epi32(1);
+    // 16 enteros de 0 o 1 se empacan a 16 bytes
+    for (; i + 16 <= n; i += 16) {
+        const __m128i *p = reinterpret_cast<const __m128i *>(numeros + i);
+        __m128i x0 = _mm_and_si128(_mm_loadu_si128(p), uno), x1 = _mm_and_si128(_mm_loadu_si128(p + 1), uno);
+        __m128i x2 = _mm_and_si128(_mm_loadu_si128(p + 2), uno), x3 = _mm_and_si128(_mm_loadu_si128(p + 3), uno);
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(x0, x1), _mm_packs_epi32(x2, x3));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(resultados + i), bytes);
+    }
+    esImparLoteGenerico(numeros + i, resultados + i, n - i);
+}
+__attribute__((target("sse4.2"))) inline void dividirLoteSse42(float *valores, size_t n) {
+    size_t i = 0;
+    // Entre 2 es exactamente por 0.5: mismo resultado, sin la latencia de dividir
+    __m128 medio = _mm_set1_ps(0.5f);
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(valores + i, _mm_mul_ps(_mm_loadu_ps(valores + i), medio));
+    dividirLoteGenerico(valores + i, n - i);
+}
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * ------------------------------------------- AVX2 -----------------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ */
+
+__attribute__((target("avx2"))) inline void sumarLoteAvx2(const int *a, const int *b, int *resultados, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(resultados + i), _mm256_add_epi32(x, y));
+    }
+    sumarLoteGenerico(a + i, b + i, resultados + i, n - i);
+}
+__attribute__((target("avx2"))) inline void doblarLoteAvx2(const int *numeros, int *resultados, size_t n, int razon) {
+    size_t i = 0;
+    __m256i r = _mm256_set1_epi32(razon);
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(numeros + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(resultados + i), _mm256_mullo_epi32(x, r));
+    }
+    doblarLoteGenerico(numeros + i, resultados + i, n - i, razon);
+}
+__attribute__((target("avx2"))) inline void esImparLoteAvx2(const int *numeros, bool *resultados, size_t n) {
+    size_t i = 0;
+    __m256i uno = _mm256_set1_epi32(1);
+    // Los empaques de AVX2 trabajan por mitades de 128 bits: la permutación final reordena
+    __m256i orden = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; i + 32 <= n; i += 32) {
+        const __m256i *p = reinterpret_cast<const __m256i *>(numeros + i);
+        __m256i x0 = _mm256_and_si256(_mm256_loadu_si256(p), uno), x1 = _mm256_and_si256(_mm256_loadu_si256(p + 1), uno);
+        __m256i x2 = _mm256_and_si256(_mm256_loadu_si256(p + 2), uno), x3 = _mm256_and_si256(_mm256_loadu_si256(p + 3), uno);
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(x0, x1), _mm256_packs_epi32(x2, x3));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(resultados + i), _mm256_permutevar8x32_epi32(bytes, orden));
+    }
+    esImparLoteGenerico(numeros + i, resultados + i, n - i);
+}
+__attribute__((target("avx2"))) inline void dividirLoteAvx2(float *valores, size_t n) {
+    size_t i = 0;
+    __m256 medio = _mm256_set1_ps(0.5f);
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(valores + i, _mm256_mul_ps(_mm256_loadu_ps(valores + i), medio));
+    dividirLoteGenerico(valores + i, n - i);
+}
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * ----------------------------------------- AVX-512 ----------------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ *
+ * Con máscaras de carga y escritura, la última vuelta procesa solo los
+ * elementos que quedan; no hace falta el ciclo genérico.
+ */
+
+__attribute__((target("avx512f"))) inline void sumarLoteAvx512(const int *a, const int *b, int *resultados, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_si512(resultados + i, _mm512_add_epi32(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+    }
+    __mmask16 m = (1u << (n - i)) - 1;
+    __m512i x = _mm512_maskz_loadu_epi32(m, a + i), y = _mm512_maskz_loadu_epi32(m, b + i);
+    _mm512_mask_storeu_epi32(resultados + i, m, _mm512_add_epi32(x, y));
+}
+__attribute__((target("avx512f"))) inline void doblarLoteAvx512(const int *numeros, int *resultados, size_t n, int razon) {
+    size_t i = 0;
+    __m512i r = _mm512_set1_epi32(razon);
+    for (; i + 16 <= n; i += 16) _mm512_storeu_si512(resultados + i, _mm512_mullo_epi32(_mm512_loadu_si512(numeros + i), r));
+    __mmask16 m = (1u << (n - i)) - 1;
+    _mm512_mask_storeu_epi32(resultados + i, m, _mm512_mullo_epi32(_mm512_maskz_loadu_epi32(m, numeros + i), r));
+}
+__attribute__((target("avx512f"))) inline void esImparLoteAvx512(const int *numeros, bool *resultados, size_t n) {
+    size_t i = 0;
+    __m512i uno = _mm512_set1_epi32(1);
+    // vpmovdb: cada entero de 32 bits se trunca a un byte al guardarse
+    for (; i + 16 <= n; i += 16) {
+        _mm512_mask_cvtepi32_storeu_epi8(resultados + i, 0xFFFF, _mm512_and_si512(_mm512_loadu_si512(numeros + i), uno));
+    }
+    __mmask16 m = (1u << (n - i)) - 1;
+    _mm512_mask_cvtepi32_storeu_epi8(resultados + i, m, _mm512_and_si512(_mm512_maskz_loadu_epi32(m, numeros + i), uno));
+}
+__attribute__((target("avx512f"))) inline void dividirLoteAvx512(float *valores, size_t n) {
+    size_t i = 0;
+    __m512 medio = _mm512_set1_ps(0.5f);
+    for (; i + 16 <= n; i += 16) _mm512_storeu_ps(valores + i, _mm512_mul_ps(_mm512_loadu_ps(valores + i), medio));
+    __mmask16 m = (1u << (n - i)) - 1;
+    _mm512_mask_storeu_ps(valores + i, m, _mm512_mul_ps(_mm512_maskz_loadu_ps(m, valores + i), medio));
+}
+#endif
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * ------------------------------------------ Despacho --------------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ */
+
+struct TablaLotes {
+    NivelSimd nivel;
+    void (*sumar)(const int *a, const int *b, int *resultados, size_t n);
+    void (*doblar)(const int *numeros, int *resultados, size_t n, int razon);
+    void (*esImpar)(const int *numeros, bool *resultados, size_t n);
+    void (*dividir)(float *valores, size_t n);
+};
+
+// Tabla de un nivel en particular (p. ej. para compararlos); falla si el procesador no lo soporta
+inline TablaLotes tablaParaNivel(NivelSimd nivel) {
+    if (nivel > detectarNivelSimd()) {
+        throw runtime_error(string("El procesador no soporta ") + nombreNivel(nivel));
+    }
+    switch (nivel) {
+#if defined(LOTES_X86)
+        case NivelSimd::AVX512: return { nivel, sumarLoteAvx512, doblarLoteAvx512, esImparLoteAvx512, dividirLoteAvx512 };
+        case NivelSimd::AVX2: return { nivel, sumarLoteAvx2, doblarLoteAvx2, esImparLoteAvx2, dividirLoteAvx2 };
+        case NivelSimd::SSE42: return { nivel, sumarLoteSse42, doblarLoteSse42, esImparLoteSse42, dividirLoteSse42 };
+#endif
+        default: return { NivelSimd::GENERICO, sumarLoteGenerico, doblarLoteGenerico, esImparLoteGenerico, dividirLoteGenerico };
+    }
+}
+
+// La mejor tabla para este procesador; se elige una sola vez
+inline const TablaLotes &tablaLotes() {
+    static const TablaLotes tabla = tablaParaNivel(detectarNivelSimd());
+    return tabla;
+}
+
+inline void sumarLote(const int *a, const int *b, int *resultados, size_t n) {
+    tablaLotes().sumar(a, b, resultados, n);
+}
+inline void doblarLote(const int *numeros, int *resultados, size_t n, int razon = 2) {
+    tablaLotes().doblar(numeros, resultados, n, razon);
+}
+inline void esImparLote(const int *numeros, bool *resultados, size_t n) {
+    tablaLotes().esImpar(numeros, resultados, n);
+}
+inline void dividirLote(float *valores, size_t n) {
+    tablaLotes().dividir(valores, n);
+}
+
+#endif
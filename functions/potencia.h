@@ -0,0 +1,172 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Potencias sin pow().
+ *
+ * pow(double, double) resuelve cualquier exponente real con logaritmos y
+ * exponenciales: para elevar al cubo es mucho más trabajo que x * x * x, no se
+ * puede evaluar al compilar y con enteros grandes pierde precisión al pasar
+ * por double. Con exponente entero basta la exponenciación binaria:
+ *
+ *   x^13 = x^8 * x^4 * x^1       (13 = 0b1101)
+ *
+ * Se eleva la base al cuadrado una vez por bit del exponente y se multiplica
+ * al resultado en los bits encendidos: O(log n) multiplicaciones.
+ */
+#ifndef POTENCIA_H
+#define POTENCIA_H
+
+/**
+ * base^exponente con enteros. Lanza overflow_error si el resultado no cabe en
+ * T, en lugar de dar la vuelta en silencio; usada en una constante, el error
+ * es de compilación.
+ */
+template <typename T>
+constexpr T potenciaEntera(T base, unsigned exponente) {
+    static_assert(is_integral<T>::value, "potenciaEntera() es para enteros");
+    T resultado = 1;
+    while (true) {
+        if ((exponente & 1) && __builtin_mul_overflow(resultado, base, &resultado)) {
+            throw overflow_error("La potencia no cabe en el tipo entero");
+        }
+        exponente >>= 1;
+        if (exponente == 0) return resultado;
+        // El último cuadrado no se calcula: solo se necesita si quedan bits
+        if (__builtin_mul_overflow(base, base, &base)) throw overflow_error("La potencia no cabe en el tipo entero");
+    }
+}
+
+// (a * b) mod m sin desbordar: el producto intermedio usa 128 bits
+constexpr uint64_t multiplicarModular(uint64_t a, uint64_t b, uint64_t modulo) {
+    return uint64_t((unsigned __int128)a * b % modulo);
+}
+
+// base^exponente mod m, p. ej. para hashes y aritmética modular (m = 10^9 + 7)
+constexpr uint64_t potenciaModular(uint64_t base, uint64_t exponente, uint64_t modulo) {
+    if (modulo == 0) throw invalid_argument("El módulo no puede ser cero");
+    uint64_t resultado = 1 % modulo;
+    base %= modulo;
+    for (; exponente != 0; exponente >>= 1) {
+        if (exponente & 1) resultado = multiplicarModular(resultado, base, modulo);
+        base = multiplicarModular(base, base, modulo);
+    }
+    return resultado;
+}
+
+/**
+ * Potencia real con exponente entero; los negativos dan 1 / x^|n|. Puede
+ * diferir de pow() en el último bit, ya que redondea en cada multiplicación.
+ */
+template <typename T>
+constexpr T potenciaReal(T base, int exponente) {
+    static_assert(is_floating_point<T>::value, "potenciaReal() es para float y double");
+    unsigned n = exponente < 0 ? 0u - unsigned(exponente) : unsigned(exponente);
+    T resultado = 1;
+    for (; n != 0; n >>= 1) {
+        if (n & 1) resultado *= base;
+        base *= base;
+    }
+    return exponente < 0 ? 1 / resultado : resultado;
+}
+
+/**
+ * Exponente conocido al compilar: potencia<3>(radio). La recursión se resuelve
+ * en la compilación y queda solo la cadena de multiplicaciones (x^8 son tres
+ * cuadrados). Funciona con cualquier tipo que tenga operador *, incluidos los
+ * registros __m128d y __m128 en GCC y Clang.
+ */
+template <unsigned N, typename T>
+constexpr T potencia(T x) {
+    if constexpr (N == 0) {
+        return T(1);
+    } else if constexpr (N == 1) {
+        return x;
+    } else {
+        T mitad = potencia<N / 2>(x);
+        if constexpr (N % 2 == 1) return mitad * mitad * x;
+        else return mitad * mitad;
+    }
+}
+
+static_assert(potenciaEntera(3, 4) == 81, "Exponenciación binaria");
+static_assert(potenciaEntera<int64_t>(-2, 63) == INT64_MIN, "El menor int64_t sí cabe");
+static_assert(potenciaModular(2, 62, 1000000007) == (uint64_t(1) << 62) % 1000000007, "Potencia modular");
+static_assert(potencia<5>(2) == 32 && potencia<0>(7.5) == 1.0, "Exponente al compilar");
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * ------------------------------------- Potencias en lote ----------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ *
+ * resultados[i] = bases[i]^exponente para arreglos enteros de float o double.
+ * Como el exponente es el mismo para todos, los bits se recorren una sola vez
+ * por registro SSE2 (2 double o 4 float) y el ciclo no tiene ramas que
+ * dependan de los datos. Se llevan dos registros a la vez para que una
+ * multiplicación no espere a la anterior.
+ */
+#if defined(__SSE2__)
+inline __m128d cargarCarriles(const double *p) { return _mm_loadu_pd(p); }
+inline __m128 cargarCarriles(const float *p) { return _mm_loadu_ps(p); }
+inline void guardarCarriles(double *p, __m128d v) { _mm_storeu_pd(p, v); }
+inline void guardarCarriles(float *p, __m128 v) { _mm_storeu_ps(p, v); }
+inline __m128d unosComo(__m128d) { return _mm_set1_pd(1.0); }
+inline __m128 unosComo(__m128) { return _mm_set1_ps(1.0f); }
+inline __m128d multiplicarCarriles(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+inline __m128 multiplicarCarriles(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+inline __m128d invertirCarriles(__m128d v) { return _mm_div_pd(_mm_set1_pd(1.0), v); }
+inline __m128 invertirCarriles(__m128 v) { return _mm_div_ps(_mm_set1_ps(1.0f), v); }
+#endif
+
+template <typename T>
+void potencias(const T *bases, T *resultados, size_t n, int exponente) {
+    static_assert(is_floating_point<T>::value, "potencias() es para float y double");
+    size_t i = 0;
+#if defined(__SSE2__)
+    constexpr size_t CARRILES = 16 / sizeof(T);
+    unsigned e = exponente < 0 ? 0u - unsigned(exponente) : unsigned(exponente);
+    for (; i + 2 * CARRILES <= n; i += 2 * CARRILES) {
+        auto b0 = cargarCarriles(bases + i), b1 = cargarCarriles(bases + i + CARRILES);
+        auto r0 = unosComo(b0), r1 = r0;
+        for (unsigned k = e; k != 0; k >>= 1) {
+            if (k & 1) {
+                r0 = multiplicarCarriles(r0, b0);
+                r1 = multiplicarCarriles(r1, b1);
+            }
+            b0 = multiplicarCarriles(b0, b0);
+            b1 = multiplicarCarriles(b1, b1);
+        }
+        if (exponente < 0) {
+            r0 = invertirCarriles(r0);
+            r1 = invertirCarriles(r1);
+        }
+        guardarCarriles(resultados + i, r0);
+        guardarCarriles(resultados + i + CARRILES, r1);
+    }
+#endif
+    for (; i < n; i++) resultados[i] = potenciaReal(bases[i], exponente);
+}
+
+// Exponente al compilar: potencia<N>() sobre registros completos
+template <unsigned N, typename T>
+void potencias(const T *bases, T *resultados, size_t n) {
+    static_assert(is_floating_point<T>::value, "potencias() es para float y double");
+    size_t i = 0;
+#if defined(__SSE2__)
+    constexpr size_t CARRILES = 16 / sizeof(T);
+    // potencia<0> necesitaría construir un registro desde T(1)
+    if constexpr (N > 0) {
+        for (; i + CARRILES <= n; i += CARRILES) guardarCarriles(resultados + i, potencia<N>(cargarCarriles(bases + i)));
+    }
+#endif
+    for (; i < n; i++) resultados[i] = potencia<N>(bases[i]);
+}
+
+#endif
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "player.h"
+/**
+ * Etapas de sistemas y cola de tareas para varios hilos.
+ */
+#include "planificador.h"
+/**
+ * Consultas de "quién está a mi alcance" sin revisar todos los pares.
+ */
+#include "rejilla.h"
+
+using namespace std;
+
+/**
+ * Motor de batallas con entidades y componentes (ECS).
+ *
+ * Player guarda todos sus datos juntos y attack() actúa sobre un solo objeto.
+ * En una batalla con un millón de jugadores conviene lo contrario: cada dato
+ * (componente) vive en su propio arreglo, indexado por el id de la entidad, y
+ * cada sistema recorre solo los arreglos que necesita:
+ *
+ *   poder   [ 10 | 50 | 10 | ... ]
+ *   salud   [ 1000 | 980 | 0 | ... ]
+ *   x, y    [ ... ]
+ *
+ * Sistemas de cada paso (tick):
+ *
+ * + Movimiento: avanza x, y según la velocidad y rebota en los bordes.
+ * + Celdas y Rejilla: reconstruyen la rejilla espacial con las posiciones
+ *   nuevas (ver rejilla.h); la celda de cada jugador se calcula por bloques y
+ *   el ordenamiento por conteo corre en un solo bloque.
+ * + Ataque: cada jugador recibe el golpe de su agresor, que debe seguir vivo
+ *   y a ALCANCE o menos (si no, se elige otro entre los vecinos de la
+ *   rejilla), si el jugador no está en el aire. Cada entidad solo escribe su
+ *   propio daño, así que los bloques pueden correr en paralelo sin
+ *   operaciones atómicas.
+ * + Salto: el equivalente masivo de jump(), con gravedad.
+ * + Salud: aplica el daño acumulado y regenera un poco a los vivos.
+ */
+#ifndef BATALLA_H
+#define BATALLA_H
+
+enum ComponenteBatalla : Componentes {
+    POSICION = 1 << 0,
+    VELOCIDAD = 1 << 1,
+    ALTURA = 1 << 2,
+    PODER = 1 << 3,
+    SALUD = 1 << 4,
+    AGRESOR = 1 << 5,
+    DANIO = 1 << 6,
+    // Celda de cada jugador y la rejilla ya ordenada
+    CELDA = 1 << 7,
+    REJILLA = 1 << 8
+};
+
+class Batalla {
+    public:
+        static constexpr int SALUD_MAXIMA = 1000;
+        static constexpr int REGENERACION = 2;
+        // Cada jugador recibe un golpe cada RITMO_ATAQUE ticks
+        static constexpr int RITMO_ATAQUE = 4;
+        static constexpr float DT = 0.05f;
+        static constexpr float GRAVEDAD = 9.8f;
+        static constexpr float IMPULSO_SALTO = 5.0f;
+        // Distancia máxima de un ataque; también es el tamaño de celda de la rejilla
+        static constexpr float ALCANCE = 20.0f;
+
+        // Componentes: un arreglo por dato, todos con el mismo número de entidades
+        vector<NombreJugador> nombre;
+        vector<int> poder;
+        vector<int> salud;
+        vector<int> danio;
+        vector<uint32_t> agresor;
+        vector<float> x, y, vx, vy;
+        vector<float> z, vz;
+
+        Batalla(unsigned hilos = thread::hardware_concurrency(), float lado = 10000.0f)
+            : planificador(hilos), rejilla(lado, ALCANCE) {
+            this->lado = lado;
+            // El orden de registro define las dependencias (ver planificador.h)
+            this->planificador.agregar({ "Movimiento", VELOCIDAD, POSICION | VELOCIDAD,
+                [this](size_t inicio, size_t fin) { this->mover(inicio, fin); } });
+            this->planificador.agregar({ "Celdas", POSICION, CELDA,
+                [this](size_t inicio, size_t fin) { this->rejilla.calcularCeldas(this->x.data(), this->y.data(), inicio, fin); } });
+            this->planificador.agregar({ "Rejilla", POSICION | CELDA, REJILLA,
+                [this](size_t, size_t fin) { this->rejilla.ordenar(this->x.data(), this->y.data(), fin); }, true });
+            this->planificador.agregar({ "Ataque", PODER | SALUD | ALTURA | POSICION | REJILLA, AGRESOR | DANIO,
+                [this](size_t inicio, size_t fin) { this->atacar(inicio, fin); } });
+            this->planificador.agregar({ "Salto", 0, ALTURA,
+                [this](size_t inicio, size_t fin) { this->saltar(inicio, fin); } });
+            this->planificador.agregar({ "Salud", DANIO, SALUD | DANIO,
+                [this](size_t inicio, size_t fin) { this->sanar(inicio, fin); } });
+        }
+
+        // Convierte a un Player en entidad; regresa su id
+        uint32_t agregar(const Player &jugador) {
+            uint32_t id = this->size();
+            uint32_t h = mezclar(id);
+            this->nombre.push_back(jugador.name);
+            this->poder.push_back(jugador.power);
+            this->salud.push_back(SALUD_MAXIMA);
+            this->danio.push_back(0);
+            // Se asigna a sí misma: el primer tick le busca un agresor
+            this->agresor.push_back(id);
+            this->x.push_back(jugador.x);
+            this->y.push_back(jugador.y);
+            this->vx.push_back(float(int(h % 21) - 10));
+            this->vy.push_back(float(int(h / 21 % 21) - 10));
+            this->z.push_back(0);
+            this->vz.push_back(0);
+            return id;
+        }
+        void reservar(size_t n) {
+            this->nombre.reserve(n);
+            this->poder.reserve(n);
+            this->salud.reserve(n);
+            this->danio.reserve(n);
+            this->agresor.reserve(n);
+            for (vector<float> *v : { &this->x, &this->y, &this->vx, &this->vy, &this->z, &this->vz }) v->reserve(n);
+        }
+
+        // Un paso de la simulación
+        void tick() {
+            this->rejilla.preparar(this->size());
+            this->planificador.ejecutar(this->size());
+            this->ticks++;
+        }
+
+        size_t size() const {
+            return this->poder.size();
+        }
+        size_t vivos() const {
+            return count_if(this->salud.begin(), this->salud.end(), [](int s) { return s > 0; });
+        }
+        uint64_t getTicks() const {
+            return this->ticks;
+        }
+        // La entidad de vuelta como Player, p. ej. para llamar a attack()
+        Player jugador(uint32_t id) const {
+            Player p(this->nombre[id], this->poder[id]);
+            p.x = this->x[id];
+            p.y = this->y[id];
+            return p;
+        }
+
+        /**
+         * Reconstruye la rejilla con las posiciones actuales. tick() ya la
+         * reconstruye después del movimiento, así que solo hace falta antes del
+         * primer tick o después de cambiar x, y a mano.
+         */
+        void actualizarRejilla() {
+            this->rejilla.construir(this->x.data(), this->y.data(), this->size(), &this->planificador);
+        }
+        // Llama a f(otro) por cada jugador a ALCANCE o menos de 'id' (sin contarlo a él)
+        template <typename Funcion>
+        void paraCadaEnRango(uint32_t id, Funcion f) const {
+            this->rejilla.paraCadaVecino(this->x[id], this->y[id], ALCANCE, [&](uint32_t otro) {
+                if (otro != id) f(otro);
+            });
+        }
+        /**
+         * Cuántos jugadores tiene a su alcance cada jugador, en paralelo. Los
+         * jugadores se recorren en el orden de la rejilla para aprovechar la caché.
+         */
+        void contarEnRango(vector<uint32_t> &cuentas) {
+            cuentas.resize(this->size());
+            this->planificador.paraBloques(this->rejilla.size(), [&](size_t inicio, size_t fin) {
+                for (size_t e = inicio; e < fin; e++) {
+                    const RejillaEspacial::Entrada &entrada = this->rejilla.entrada(e);
+                    // Se cuenta a sí mismo, por eso se empieza en -1
+                    uint32_t total = uint32_t(-1);
+                    this->rejilla.paraCadaVecino(entrada.x, entrada.y, ALCANCE, [&total](uint32_t) { total++; });
+                    cuentas[entrada.id] = total;
+                }
+            });
+        }
+        const RejillaEspacial &getRejilla() const {
+            return this->rejilla;
+        }
+        const Planificador &getPlanificador() const {
+            return this->planificador;
+        }
+    private:
+        Planificador planificador;
+        RejillaEspacial rejilla;
+        float lado;
+        uint64_t ticks = 0;
+
+        // Pseudoaleatorio determinista: el resultado no depende del número de hilos
+        static uint32_t mezclar(uint64_t valor) {
+            valor ^= valor >> 33;
+            valor *= 0xff51afd7ed558ccdULL;
+            valor ^= valor >> 33;
+            return uint32_t(valor);
+        }
+
+        void mover(size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; i++) {
+                this->x[i] += this->vx[i] * DT;
+                this->y[i] += this->vy[i] * DT;
+                if (this->x[i] < 0 || this->x[i] >= this->lado) {
+                    this->vx[i] = -this->vx[i];
+                    this->x[i] = clamp(this->x[i], 0.0f, nextafter(this->lado, 0.0f));
+                }
+                if (this->y[i] < 0 || this->y[i] >= this->lado) {
+                    this->vy[i] = -this->vy[i];
+                    this->y[i] = clamp(this->y[i], 0.0f, nextafter(this->lado, 0.0f));
+                }
+            }
+        }
+
+        void atacar(size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; i++) {
+                if (this->salud[i] <= 0) {
+                    this->danio[i] = 0;
+                    continue;
+                }
+                uint32_t a = this->agresor[i];
+                // Si el agresor cayó o se alejó (o se eligió a sí mismo), se busca otro
+                if (a == i || this->salud[a] <= 0 || !this->alAlcance(i, a)) {
+                    a = this->agresor[i] = this->buscarAgresor(i);
+                }
+                bool golpea = (i + this->ticks) % RITMO_ATAQUE == 0 && a != i && this->z[i] == 0;
+                this->danio[i] = golpea ? this->poder[a] : 0;
+            }
+        }
+        // Misma cuenta que Player::enRango() y que la rejilla
+        bool alAlcance(uint32_t i, uint32_t otro) const {
+            float dx = this->x[otro] - this->x[i], dy = this->y[otro] - this->y[i];
+            return dx * dx + dy * dy <= ALCANCE * ALCANCE;
+        }
+        /**
+         * Un vecino vivo a su alcance, o él mismo si no hay ninguno. Se queda
+         * con el de menor mezcla: el resultado no depende del orden en que la
+         * rejilla entrega a los vecinos.
+         */
+        uint32_t buscarAgresor(uint32_t i) const {
+            uint32_t elegido = i;
+            uint64_t menor = UINT64_MAX;
+            this->paraCadaEnRango(i, [&](uint32_t otro) {
+                if (this->salud[otro] <= 0) return;
+                uint64_t clave = uint64_t(mezclar(uint64_t(otro) << 32 ^ i ^ this->ticks << 20)) << 32 | otro;
+                if (clave < menor) {
+                    menor = clave;
+                    elegido = otro;
+                }
+            });
+            return elegido;
+        }
+
+        void saltar(size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; i++) {
+                if (this->z[i] == 0 && (i + this->ticks) % 64 == 0) this->vz[i] = IMPULSO_SALTO;
+                this->z[i] += this->vz[i] * DT;
+                this->vz[i] -= GRAVEDAD * DT;
+                if (this->z[i] <= 0) {
+                    this->z[i] = 0;
+                    this->vz[i] = 0;
+                }
+            }
+        }
+
+        void sanar(size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; i++) {
+                if (this->salud[i] <= 0) continue;
+                this->salud[i] = min(SALUD_MAXIMA, this->salud[i] - this->danio[i] + REGENERACION);
+                this->danio[i] = 0;
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,205 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "cadenas.h"
+#include "player.h"
+#include "batalla.h"
+
+using namespace std;
+
+/**
+ * Contando la memoria dinámica reservada reemplazando el operator new global.
+ */
+static size_t bytesReservados = 0;
+
+void *operator new(size_t tamanio) {
+    bytesReservados += tamanio;
+    if (void *p = malloc(tamanio)) return p;
+    throw bad_alloc();
+}
+void operator delete(void *p) noexcept {
+    free(p);
+}
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+// Versiones "antes" de las clases: cada nombre es un std::string copiado por valor
+struct PlayerConString {
+    string name;
+    int power;
+    PlayerConString(string name, int power) {
+        this->name = name;
+        this->power = power;
+    }
+};
+
+struct AutoConString {
+    string marca;
+    string modelo;
+    AutoConString(string marca, string modelo) {
+        this->marca = marca;
+        this->modelo = modelo;
+    }
+};
+
+struct AutoInternado {
+    CadenaInterna marca;
+    CadenaInterna modelo;
+    AutoInternado(CadenaInterna marca, CadenaInterna modelo) {
+        this->marca = marca;
+        this->modelo = modelo;
+    }
+};
+
+/**
+ * Construye N entidades y reporta ns por entidad y bytes por entidad
+ * (sizeof + memoria dinámica), sin contar el vector que las contiene.
+ */
+template <typename T, typename Crear>
+void medir(const char *nombre, size_t n, Crear crear) {
+    vector<T> entidades;
+    entidades.reserve(n);
+    size_t bytesAntes = bytesReservados;
+    auto inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) entidades.push_back(crear(i));
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / n;
+    double heap = double(bytesReservados - bytesAntes) / n;
+    cout << nombre << ": " << ns << " ns/entidad, sizeof " << sizeof(T) << " B + " << heap << " B dinámicos" << endl;
+}
+
+void benchNombres() {
+    const size_t N = 2000000;
+    vector<string> nombres, marcas = { "Volkswagen", "Nissan", "Mercedes-Benz", "Kia" };
+    vector<string> modelos = { "Jetta", "Altima", "Clase E Coupe Cabriolet", "Grand Cherokee Limited" };
+    for (size_t i = 0; i < 1000; i++) nombres.push_back("Jugador_numero_" + to_string(100000 + i));
+
+    medir<PlayerConString>("Player con std::string", N, [&](size_t i) {
+        return PlayerConString(nombres[i % nombres.size()], 10);
+    });
+    medir<Player>("Player con CadenaDerramable<23>", N, [&](size_t i) {
+        return Player(nombres[i % nombres.size()], 10);
+    });
+
+    medir<AutoConString>("Auto con std::string", N, [&](size_t i) {
+        return AutoConString(marcas[i % 4], modelos[(i / 4) % 4]);
+    });
+    medir<AutoInternado>("Auto con CadenaInterna", N, [&](size_t i) {
+        return AutoInternado(marcas[i % 4], modelos[(i / 4) % 4]);
+    });
+
+    // Con ids ya internados, construir solo copia dos enteros
+    CadenaInterna marcasInternas[] = { marcas[0], marcas[1], marcas[2], marcas[3] };
+    CadenaInterna modelosInternos[] = { modelos[0], modelos[1], modelos[2], modelos[3] };
+    medir<AutoInternado>("Auto con ids ya internados", N, [&](size_t i) {
+        return AutoInternado(marcasInternas[i % 4], modelosInternos[(i / 4) % 4]);
+    });
+}
+
+// Jugadores repartidos al azar (con semilla fija) en el mapa de 10,000 x 10,000
+void poblar(Batalla &batalla, size_t n) {
+    mt19937 generador(11);
+    uniform_real_distribution<float> coordenada(0.0f, 10000.0f);
+    batalla.reservar(n);
+    for (size_t i = 0; i < n; i++) {
+        Player jugador = Player("Jugador_" + to_string(i), 5 + int(i % 46));
+        jugador.x = coordenada(generador);
+        jugador.y = coordenada(generador);
+        batalla.agregar(jugador);
+    }
+}
+
+/**
+ * Ticks por segundo de una batalla de un millón de jugadores con distintos
+ * números de hilos (cada tick incluye reconstruir la rejilla y buscar
+ * agresores a su alcance). Los jugadores vivos al final deben ser los mismos en
+ * todas las corridas: el resultado no depende de cómo se repartan los bloques.
+ */
+void benchBatalla() {
+    const size_t N = 1000000;
+    const int TICKS = 250;
+    unsigned nucleos = thread::hardware_concurrency();
+    cout << "Batalla de " << N << " jugadores, " << TICKS << " ticks (" << nucleos << " núcleos)" << endl;
+
+    vector<unsigned> hilos = { 1, 2, 4 };
+    if (nucleos > 4) hilos.push_back(nucleos);
+    for (unsigned h : hilos) {
+        Batalla batalla(h);
+        poblar(batalla, N);
+        batalla.tick();
+
+        auto inicio = chrono::steady_clock::now();
+        for (int t = 0; t < TICKS; t++) batalla.tick();
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        cout << h << " hilos: " << TICKS / segundos << " ticks/s, " << segundos * 1e9 / TICKS / N
+             << " ns por jugador por tick, " << batalla.vivos() << " vivos" << endl;
+    }
+}
+
+/**
+ * Costo de reconstruir la rejilla y de responder "quién está a mi alcance" para
+ * todos los jugadores en cada tick, contra revisar todos los pares. Revisar
+ * todos los pares para un millón de jugadores tomaría demasiado, así que se
+ * mide con una muestra de jugadores y se extrapola.
+ */
+void benchRejilla() {
+    const size_t N = 1000000;
+    const int TICKS = 10;
+    const size_t MUESTRA = 200;
+    Batalla batalla;
+    poblar(batalla, N);
+
+    double segundosRejilla = 0, segundosConsultas = 0;
+    vector<uint32_t> cuentas;
+    for (int t = 0; t < TICKS; t++) {
+        // tick() ya reconstruye la rejilla; se reconstruye otra vez aparte para medirla sola
+        batalla.tick();
+        auto inicio = chrono::steady_clock::now();
+        batalla.actualizarRejilla();
+        auto construida = chrono::steady_clock::now();
+        batalla.contarEnRango(cuentas);
+        auto fin = chrono::steady_clock::now();
+        segundosRejilla += chrono::duration<double>(construida - inicio).count();
+        segundosConsultas += chrono::duration<double>(fin - construida).count();
+    }
+
+    // Todos los pares, solo para una muestra de jugadores
+    size_t diferencias = 0;
+    float alcance2 = Batalla::ALCANCE * Batalla::ALCANCE;
+    auto inicio = chrono::steady_clock::now();
+    for (size_t m = 0; m < MUESTRA; m++) {
+        size_t id = m * (N / MUESTRA);
+        uint32_t total = 0;
+        for (size_t otro = 0; otro < N; otro++) {
+            float dx = batalla.x[otro] - batalla.x[id], dy = batalla.y[otro] - batalla.y[id];
+            total += otro != id && dx * dx + dy * dy <= alcance2;
+        }
+        diferencias += total != cuentas[id];
+    }
+    double nsTodosLosPares = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / MUESTRA;
+
+    size_t vecinos = 0;
+    for (uint32_t c : cuentas) vecinos += c;
+    cout << "Rejilla de " << batalla.getRejilla().getColumnas() << " x " << batalla.getRejilla().getColumnas()
+         << " celdas, " << N << " jugadores, " << double(vecinos) / N << " vecinos promedio" << endl;
+    cout << "Reconstruir la rejilla (counting sort): " << segundosRejilla * 1e3 / TICKS << " ms por tick" << endl;
+    cout << "Consultas de alcance con rejilla: " << segundosConsultas * 1e9 / TICKS / N << " ns por jugador, "
+         << segundosConsultas * 1e3 / TICKS << " ms por tick" << endl;
+    cout << "Todos los pares: " << nsTodosLosPares << " ns por jugador, ~" << nsTodosLosPares * N / 1e9
+         << " s por tick (" << diferencias << " diferencias en " << MUESTRA << " muestras)" << endl;
+}
+
+int main() {
+
+    benchNombres();
+    cout << endl;
+    benchBatalla();
+    cout << endl;
+    benchRejilla();
+
+    return 0;
+}
@@ -0,0 +1,295 @@
+// Otras bibliotecas
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Utilidades para nombres cortos y repetitivos (jugadores, marcas, modelos).
+ *
+ * Cada std::string con más de 15 caracteres reserva memoria dinámica, y cada
+ * copia de un string repite esa reserva. Este archivo de cabecera ofrece dos
+ * alternativas:
+ *
+ *   - CadenaCorta<N>: texto de hasta N caracteres guardado dentro del mismo
+ *     objeto, sin memoria dinámica.
+ *   - CadenaInterna: un id de 32 bits hacia una tabla global (interner) donde
+ *     cada texto distinto se guarda una sola vez. Ideal cuando millones de
+ *     objetos repiten unos cuantos valores, como "Nissan" o "Altima".
+ *   - CadenaDerramable<N>: como CadenaCorta<N>, pero un texto más largo que N
+ *     se derrama al interner en lugar de rechazarse.
+ */
+#ifndef CADENAS_H
+#define CADENAS_H
+
+template <size_t N>
+class CadenaCorta {
+    static_assert(N < 256, "La longitud se guarda en un byte");
+    public:
+        CadenaCorta() = default;
+        CadenaCorta(string_view texto) {
+            if (texto.size() > N) {
+                throw length_error("El texto excede la capacidad de CadenaCorta");
+            }
+            memcpy(datos, texto.data(), texto.size());
+            longitud = texto.size();
+        }
+        CadenaCorta(const char *texto) : CadenaCorta(string_view(texto)) {}
+        CadenaCorta(const string &texto) : CadenaCorta(string_view(texto)) {}
+
+        static constexpr size_t capacidad() { return N; }
+        size_t size() const { return longitud; }
+        const char *data() const { return datos; }
+        operator string_view() const { return string_view(datos, longitud); }
+        string str() const { return string(datos, longitud); }
+
+        bool operator==(const CadenaCorta &otra) const {
+            return string_view(*this) == string_view(otra);
+        }
+    private:
+        char datos[N] = {};
+        uint8_t longitud = 0;
+};
+
+template <size_t N>
+ostream &operator<<(ostream &salida, const CadenaCorta<N> &cadena) {
+    return salida << string_view(cadena);
+}
+
+/**
+ * Tabla global de textos únicos.
+ *
+ * - Lectura sin candados: texto(id) solo lee punteros publicados con atomic,
+ *   y buscar(texto) recorre una tabla hash de direccionamiento abierto cuyas
+ *   casillas también son atómicas.
+ * - Escritura con candado: solo cuando aparece un texto nuevo se toma el mutex.
+ *
+ * Los textos nunca se eliminan, por lo que un id siempre sigue siendo válido.
+ */
+class Interner {
+    public:
+        static Interner &global() {
+            static Interner instancia;
+            return instancia;
+        }
+
+        uint32_t intern(string_view texto) {
+            uint32_t hash = this->hashTexto(texto);
+            uint32_t id;
+            if (this->buscar(texto, hash, id)) return id;
+
+            lock_guard<mutex> candado(escritura);
+            if (this->buscar(texto, hash, id)) return id;
+            id = cantidad.load(memory_order_relaxed);
+            this->guardarEntrada(id, texto, hash);
+            Tabla *tabla = tablaActual.load(memory_order_relaxed);
+            if ((id + 1) * 2 > tabla->capacidad) tabla = this->crecer();
+            this->insertarCasilla(tabla, hash, id);
+            cantidad.store(id + 1, memory_order_release);
+            return id;
+        }
+
+        // Camino de lectura sin candados
+        string_view texto(uint32_t id) const {
+            const Entrada &e = bloques[id >> BITS_BLOQUE].load(memory_order_acquire)[id & (TAMANIO_BLOQUE - 1)];
+            return string_view(e.datos, e.longitud);
+        }
+
+        bool buscar(string_view texto, uint32_t &id) const {
+            return this->buscar(texto, this->hashTexto(texto), id);
+        }
+
+        size_t size() const {
+            return cantidad.load(memory_order_acquire);
+        }
+    private:
+        static constexpr uint32_t BITS_BLOQUE = 16;
+        static constexpr uint32_t TAMANIO_BLOQUE = 1 << BITS_BLOQUE;
+        static constexpr uint32_t MAX_BLOQUES = 1 << 16; // Hasta 2^32 textos
+
+        struct Entrada {
+            const char *datos;
+            uint32_t longitud;
+            uint32_t hash;
+        };
+        struct Tabla {
+            size_t capacidad;
+            unique_ptr<atomic<uint32_t>[]> casillas; // id + 1, o 0 si está vacía
+        };
+
+        // Bloques de entradas que nunca se mueven de lugar una vez publicados
+        unique_ptr<atomic<Entrada *>[]> bloques;
+        vector<unique_ptr<Entrada[]>> duenosBloques;
+        atomic<Tabla *> tablaActual;
+        // Tablas anteriores: un lector podría seguir usándolas, así que no se liberan antes de tiempo
+        vector<unique_ptr<Tabla>> tablas;
+        vector<unique_ptr<char[]>> textos;
+        char *cursor = nullptr;
+        size_t disponible = 0;
+        atomic<uint32_t> cantidad{0};
+        mutex escritura;
+
+        Interner() : bloques(new atomic<Entrada *>[MAX_BLOQUES]) {
+            for (uint32_t i = 0; i < MAX_BLOQUES; i++) bloques[i].store(nullptr, memory_order_relaxed);
+            tablas.emplace_back(this->nuevaTabla(1024));
+            tablaActual.store(tablas.back().get(), memory_order_release);
+        }
+
+        static uint32_t hashTexto(string_view texto) {
+            // FNV-1a de 32 bits
+            uint32_t h = 2166136261u;
+            for (char c : texto) h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+            return h;
+        }
+
+        bool buscar(string_view texto, uint32_t hash, uint32_t &id) const {
+            Tabla *tabla = tablaActual.load(memory_order_acquire);
+            size_t mascara = tabla->capacidad - 1;
+            for (size_t i = hash & mascara; ; i = (i + 1) & mascara) {
+                uint32_t valor = tabla->casillas[i].load(memory_order_acquire);
+                if (valor == 0) return false;
+                const Entrada &e = bloques[(valor - 1) >> BITS_BLOQUE].load(memory_order_acquire)[(valor - 1) & (TAMANIO_BLOQUE - 1)];
+                if (e.hash == hash && string_view(e.datos, e.longitud) == texto) {
+                    id = valor - 1;
+                    return true;
+                }
+            }
+        }
+
+        Tabla *nuevaTabla(size_t capacidad) {
+            Tabla *tabla = new Tabla{ capacidad, unique_ptr<atomic<uint32_t>[]>(new atomic<uint32_t>[capacidad]) };
+            for (size_t i = 0; i < capacidad; i++) tabla->casillas[i].store(0, memory_order_relaxed);
+            return tabla;
+        }
+
+        void insertarCasilla(Tabla *tabla, uint32_t hash, uint32_t id) {
+            size_t mascara = tabla->capacidad - 1;
+            size_t i = hash & mascara;
+            while (tabla->casillas[i].load(memory_order_relaxed) != 0) i = (i + 1) & mascara;
+            tabla->casillas[i].store(id + 1, memory_order_release);
+        }
+
+        void guardarEntrada(uint32_t id, string_view texto, uint32_t hash) {
+            uint32_t bloque = id >> BITS_BLOQUE;
+            if (bloque >= MAX_BLOQUES) throw length_error("Interner lleno");
+            if (bloques[bloque].load(memory_order_relaxed) == nullptr) {
+                duenosBloques.emplace_back(new Entrada[TAMANIO_BLOQUE]);
+                bloques[bloque].store(duenosBloques.back().get(), memory_order_release);
+            }
+            // Copiando el texto a un bloque de caracteres propio del interner
+            if (cursor == nullptr || texto.size() > disponible) {
+                size_t tamanio = max<size_t>(texto.size(), 64 * 1024);
+                textos.emplace_back(new char[tamanio]);
+                cursor = textos.back().get();
+                disponible = tamanio;
+            }
+            memcpy(cursor, texto.data(), texto.size());
+            bloques[bloque].load(memory_order_relaxed)[id & (TAMANIO_BLOQUE - 1)] = { cursor, static_cast<uint32_t>(texto.size()), hash };
+            cursor += texto.size();
+            disponible -= texto.size();
+        }
+
+        // Duplica la tabla y la publica; los lectores cambian a ella en su siguiente búsqueda
+        Tabla *crecer() {
+            Tabla *anterior = tablaActual.load(memory_order_relaxed);
+            Tabla *tabla = this->nuevaTabla(anterior->capacidad * 2);
+            uint32_t total = cantidad.load(memory_order_relaxed);
+            for (uint32_t id = 0; id < total; id++) {
+                const Entrada &e = bloques[id >> BITS_BLOQUE].load(memory_order_relaxed)[id & (TAMANIO_BLOQUE - 1)];
+                this->insertarCasilla(tabla, e.hash, id);
+            }
+            tablas.emplace_back(tabla);
+            tablaActual.store(tabla, memory_order_release);
+            return tabla;
+        }
+};
+
+/**
+ * Texto internado: ocupa 4 bytes y copiarlo es copiar un entero. Se construye
+ * implícitamente desde string o const char*, por lo que puede usarse en lugar
+ * de un string como parámetro o miembro de clase.
+ */
+class CadenaInterna {
+    public:
+        CadenaInterna() : CadenaInterna(string_view()) {}
+        CadenaInterna(string_view texto) {
+            this->id = Interner::global().intern(texto);
+        }
+        CadenaInterna(const char *texto) : CadenaInterna(string_view(texto)) {}
+        CadenaInterna(const string &texto) : CadenaInterna(string_view(texto)) {}
+
+        uint32_t valor() const { return id; }
+        string_view texto() const { return Interner::global().texto(id); }
+        operator string_view() const { return this->texto(); }
+        string str() const { return string(this->texto()); }
+
+        // Dos textos iguales siempre tienen el mismo id
+        bool operator==(const CadenaInterna &otra) const { return id == otra.id; }
+        bool operator!=(const CadenaInterna &otra) const { return id != otra.id; }
+    private:
+        uint32_t id;
+};
+
+inline ostream &operator<<(ostream &salida, const CadenaInterna &cadena) {
+    return salida << cadena.texto();
+}
+
+/**
+ * Texto de cualquier longitud que ocupa lo mismo que una CadenaCorta<N>. Hasta
+ * N caracteres se guardan dentro del objeto; uno más largo (poco común, p. ej.
+ * un nombre de jugador muy largo) se guarda en el interner y el objeto solo
+ * conserva su id. La longitud DERRAMADA marca el segundo caso.
+ */
+template <size_t N>
+class CadenaDerramable {
+    static_assert(N >= sizeof(uint32_t) && N < 255, "Debe caber un id y la longitud se guarda en un byte");
+    public:
+        CadenaDerramable() = default;
+        CadenaDerramable(string_view texto) {
+            if (texto.size() <= N) {
+                memcpy(datos, texto.data(), texto.size());
+                longitud = texto.size();
+            } else {
+                uint32_t id = Interner::global().intern(texto);
+                memcpy(datos, &id, sizeof(id));
+                longitud = DERRAMADA;
+            }
+        }
+        CadenaDerramable(const char *texto) : CadenaDerramable(string_view(texto)) {}
+        CadenaDerramable(const string &texto) : CadenaDerramable(string_view(texto)) {}
+
+        bool derramada() const { return longitud == DERRAMADA; }
+        size_t size() const { return string_view(*this).size(); }
+        operator string_view() const {
+            if (!this->derramada()) return string_view(datos, longitud);
+            uint32_t id;
+            memcpy(&id, datos, sizeof(id));
+            return Interner::global().texto(id);
+        }
+        string str() const { return string(string_view(*this)); }
+
+        bool operator==(const CadenaDerramable &otra) const {
+            return string_view(*this) == string_view(otra);
+        }
+    private:
+        static constexpr uint8_t DERRAMADA = 255;
+
+        char datos[N] = {};
+        uint8_t longitud = 0;
+};
+
+template <size_t N>
+ostream &operator<<(ostream &salida, const CadenaDerramable<N> &cadena) {
+    return salida << string_view(cadena);
+}
+
+#endif
@@ -4,6 +4,10 @@
  * Importando el archivo de cabecera personalizado.
  */
 #include "player.h"
+/**
+ * Motor de batallas: los datos de los jugadores en arreglos por componente.
+ */
+#include "batalla.h"
 
 using namespace std;
 
@@ -12,8 +16,43 @@ int main() {
     Player p1 = Player("María");
     Player p2 = Player("Ivan", 50);
 
+    // Un nombre de más de 23 caracteres no cabe en el objeto y se guarda en el interner
+    Player p3 = Player("Maximiliano de la Cruz Hernández", 40);
+
     p1.attack();
     p2.attack();
+    p3.attack();
+    cout << endl;
+
+    Batalla batalla(2);
+    batalla.agregar(p1);
+    batalla.agregar(p2);
+    for (int i = 0; i < 6; i++) {
+        Player bot = Player("Bot_" + to_string(i), 20 + 10 * i);
+        bot.x = 5.0f * i;
+        bot.y = 5.0f * i;
+        batalla.agregar(bot);
+    }
+
+    // ¿Quién está al alcance de María (en 0, 0)? Cada tick reconstruye la rejilla; antes del primero se construye a mano
+    batalla.actualizarRejilla();
+    cout << "Al alcance de " << p1.name << ":";
+    batalla.paraCadaEnRango(0, [&](uint32_t otro) { cout << " " << batalla.nombre[otro]; });
+    cout << endl;
+
+    const Planificador &planificador = batalla.getPlanificador();
+    for (size_t e = 0; e < planificador.getEtapas().size(); e++) {
+        cout << "Etapa " << e << ":";
+        for (size_t s : planificador.getEtapas()[e]) cout << " " << planificador.getSistemas()[s].nombre;
+        cout << endl;
+    }
+
+    for (int t = 0; t < 500; t++) batalla.tick();
+    cout << "Después de " << batalla.getTicks() << " ticks quedan " << batalla.vivos()
+         << " de " << batalla.size() << " jugadores" << endl;
+    for (uint32_t id = 0; id < batalla.size(); id++) {
+        if (batalla.salud[id] > 0) batalla.jugador(id).attack();
+    }
 
     return 0;
 }
\ No newline at end of file
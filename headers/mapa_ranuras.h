@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Mapa de ranuras generacional (slot map) para entidades que se crean y se
+ * destruyen todo el tiempo.
+ *
+ * Con 'new' cada objeto queda en un lugar distinto del heap; tras muchas altas
+ * y bajas la memoria se fragmenta, recorrerlos salta de puntero en puntero, y
+ * un puntero a un objeto ya borrado no se puede detectar. El mapa de ranuras
+ * usa tres arreglos:
+ *
+ *   densos  [T | T | T | ...]          los objetos, contiguos y sin huecos
+ *   duenios [ranura | ranura | ...]    la ranura de cada objeto denso
+ *   ranuras [{denso, generación} ...]  indirección estable hacia 'densos'
+ *
+ * Un Manejador (64 bits) guarda la ranura y su generación. Al eliminar, el
+ * último objeto denso se mueve al hueco (se actualiza su ranura) y la
+ * generación de la ranura eliminada avanza, así que los manejadores viejos
+ * dejan de coincidir. Insertar, eliminar y obtener son O(1), y recorrer es
+ * recorrer un vector.
+ *
+ * La generación es impar mientras la ranura está ocupada y par mientras está
+ * libre: un manejador válido siempre tiene generación impar.
+ */
+#ifndef MAPA_RANURAS_H
+#define MAPA_RANURAS_H
+
+struct Manejador {
+    uint32_t indice;
+    uint32_t generacion;
+
+    // Generación par: nunca corresponde a un objeto
+    static Manejador nulo() { return { 0, 0 }; }
+    uint64_t valor() const { return uint64_t(generacion) << 32 | indice; }
+    bool operator==(const Manejador &otro) const { return indice == otro.indice && generacion == otro.generacion; }
+    bool operator!=(const Manejador &otro) const { return !(*this == otro); }
+};
+
+static_assert(sizeof(Manejador) == 8, "Manejador ocupa 64 bits");
+
+template <typename T>
+class MapaRanuras {
+    public:
+        /**
+         * Construye el objeto directamente en el arreglo denso. El espacio de
+         * 'ranuras' y 'duenios' se reserva antes: si reservar o el constructor
+         * de T lanzan, el mapa queda como estaba, y después de construir ya
+         * nada puede fallar.
+         */
+        template <typename... Args>
+        Manejador insertar(Args &&... args) {
+            if (this->libre == NINGUNO && this->ranuras.size() >= NINGUNO) {
+                throw length_error("MapaRanuras usa índices de 32 bits");
+            }
+            if (this->libre == NINGUNO) crecer(this->ranuras);
+            crecer(this->duenios);
+            this->densos.emplace_back(forward<Args>(args)...);
+            uint32_t i;
+            if (this->libre != NINGUNO) {
+                i = this->libre;
+                this->libre = this->ranuras[i].denso;
+            } else {
+                this->ranuras.push_back({ 0, 0 });
+                i = this->ranuras.size() - 1;
+            }
+            Ranura &ranura = this->ranuras[i];
+            ranura.denso = this->densos.size() - 1;
+            ranura.generacion++;
+            this->duenios.push_back(i);
+            return { i, ranura.generacion };
+        }
+
+        // Regresa false si el manejador ya no es válido
+        bool eliminar(Manejador m) {
+            if (!this->contiene(m)) return false;
+            Ranura &ranura = this->ranuras[m.indice];
+            uint32_t hueco = ranura.denso, ultimo = this->densos.size() - 1;
+            if (hueco != ultimo) {
+                this->densos[hueco] = move(this->densos[ultimo]);
+                this->duenios[hueco] = this->duenios[ultimo];
+                this->ranuras[this->duenios[hueco]].denso = hueco;
+            }
+            this->densos.pop_back();
+            this->duenios.pop_back();
+            ranura.generacion++;
+            // Una ranura que agotó sus generaciones se retira para no repetir manejadores
+            if (ranura.generacion != UINT32_MAX - 1) {
+                ranura.denso = this->libre;
+                this->libre = m.indice;
+            }
+            return true;
+        }
+
+        bool contiene(Manejador m) const {
+            return m.indice < this->ranuras.size() && this->ranuras[m.indice].generacion == m.generacion && (m.generacion & 1);
+        }
+        // nullptr si el manejador ya no es válido
+        T *obtener(Manejador m) {
+            return this->contiene(m) ? &this->densos[this->ranuras[m.indice].denso] : nullptr;
+        }
+        const T *obtener(Manejador m) const {
+            return this->contiene(m) ? &this->densos[this->ranuras[m.indice].denso] : nullptr;
+        }
+        T &operator[](Manejador m) {
+            T *objeto = this->obtener(m);
+            if (objeto == nullptr) throw out_of_range("Manejador inválido o de un objeto eliminado");
+            return *objeto;
+        }
+
+        // Manejador del objeto en la posición 'i' del arreglo denso
+        Manejador manejadorDe(size_t i) const {
+            uint32_t r = this->duenios[i];
+            return { r, this->ranuras[r].generacion };
+        }
+
+        /**
+         * Recorrido denso: el orden cambia al eliminar (el último objeto ocupa
+         * el hueco), así que no se debe eliminar mientras se recorre.
+         */
+        typename vector<T>::iterator begin() { return this->densos.begin(); }
+        typename vector<T>::iterator end() { return this->densos.end(); }
+        typename vector<T>::const_iterator begin() const { return this->densos.begin(); }
+        typename vector<T>::const_iterator end() const { return this->densos.end(); }
+
+        void reservar(size_t cantidad) {
+            this->densos.reserve(cantidad);
+            this->duenios.reserve(cantidad);
+            this->ranuras.reserve(cantidad);
+        }
+        size_t size() const {
+            return this->densos.size();
+        }
+        bool empty() const {
+            return this->densos.empty();
+        }
+    private:
+        static constexpr uint32_t NINGUNO = UINT32_MAX;
+
+        struct Ranura {
+            // Posición en 'densos' si está ocupada; siguiente ranura libre si no
+            uint32_t denso;
+            uint32_t generacion;
+        };
+
+        vector<T> densos;
+        vector<uint32_t> duenios;
+        vector<Ranura> ranuras;
+        uint32_t libre = NINGUNO;
+
+        // Deja lugar para un elemento más, creciendo al doble como push_back
+        template <typename U>
+        static void crecer(vector<U> &v) {
+            if (v.size() == v.capacity()) v.reserve(max<size_t>(2 * v.capacity(), 8));
+        }
+};
+
+#endif
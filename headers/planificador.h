@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Planificador de sistemas para un motor ECS (Entity Component System).
+ *
+ * Cada sistema declara qué componentes lee y cuáles escribe (máscaras de
+ * bits). Dos sistemas son independientes si ninguno escribe algo que el otro
+ * lee o escribe; el planificador agrupa a los independientes en una misma
+ * etapa y las etapas se ejecutan en el orden en que se registraron los
+ * sistemas que entran en conflicto.
+ *
+ *   etapa 0: [ Movimiento ]            --> barrera
+ *   etapa 1: [ Celdas ]                --> barrera
+ *   etapa 2: [ Rejilla ]               --> barrera
+ *   etapa 3: [ Ataque ]                --> barrera
+ *   etapa 4: [ Salto | Salud ]         --> barrera
+ *
+ * Dentro de una etapa, cada sistema se parte en bloques de entidades y todos
+ * los bloques van a una misma cola de tareas que los hilos toman con un
+ * contador atómico, así un sistema grande se reparte entre todos los hilos.
+ * Un sistema que no se puede partir (p. ej. un ordenamiento por conteo) se
+ * marca con unSoloBloque: recibe [0, n) en un solo hilo, en paralelo con los
+ * demás sistemas de su etapa.
+ *
+ * Los sistemas no deben lanzar excepciones ni llamar a paraBloques().
+ */
+#ifndef PLANIFICADOR_H
+#define PLANIFICADOR_H
+
+typedef uint32_t Componentes;
+
+struct Sistema {
+    const char *nombre;
+    Componentes lee;
+    Componentes escribe;
+    // Procesa las entidades [inicio, fin)
+    function<void(size_t, size_t)> ejecutar;
+    bool unSoloBloque = false;
+};
+
+class Planificador {
+    public:
+        // 'hilos' incluye al hilo que llama a ejecutar()
+        explicit Planificador(unsigned hilos = thread::hardware_concurrency(), size_t tamanioBloque = 16384) {
+            this->tamanioBloque = tamanioBloque > 0 ? tamanioBloque : 1;
+            for (unsigned h = 1; h < hilos; h++) this->trabajadores.emplace_back([this]() { this->trabajar(); });
+        }
+        Planificador(const Planificador &) = delete;
+        Planificador &operator=(const Planificador &) = delete;
+        ~Planificador() {
+            {
+                lock_guard<mutex> candado(this->m);
+                this->detener = true;
+            }
+            this->hayTrabajo.notify_all();
+            for (thread &t : this->trabajadores) t.join();
+        }
+
+        /**
+         * Un sistema entra en la etapa siguiente a la última con la que tiene
+         * conflicto, así nunca se adelanta a uno registrado antes que él.
+         */
+        void agregar(Sistema sistema) {
+            size_t etapa = 0;
+            for (size_t e = 0; e < this->etapas.size(); e++) {
+                for (size_t s : this->etapas[e]) {
+                    if (conflicto(this->sistemas[s], sistema)) etapa = e + 1;
+                }
+            }
+            if (etapa == this->etapas.size()) this->etapas.emplace_back();
+            this->etapas[etapa].push_back(this->sistemas.size());
+            this->sistemas.push_back(move(sistema));
+        }
+
+        static bool conflicto(const Sistema &a, const Sistema &b) {
+            return (a.escribe & (b.lee | b.escribe)) != 0 || (b.escribe & a.lee) != 0;
+        }
+
+        // Un paso de la simulación: todas las etapas sobre 'entidades' entidades
+        void ejecutar(size_t entidades) {
+            for (const vector<size_t> &etapa : this->etapas) {
+                vector<Tarea> tareas;
+                for (size_t s : etapa) {
+                    const Sistema &sistema = this->sistemas[s];
+                    if (!sistema.unSoloBloque) this->partir(sistema.ejecutar, entidades, tareas);
+                    else if (entidades > 0) tareas.push_back({ &sistema.ejecutar, 0, entidades });
+                }
+                this->lanzar(move(tareas));
+            }
+        }
+
+        // Ciclo for paralelo genérico sobre [0, n), en bloques
+        void paraBloques(size_t n, const function<void(size_t, size_t)> &f) {
+            vector<Tarea> tareas;
+            this->partir(f, n, tareas);
+            this->lanzar(move(tareas));
+        }
+
+        unsigned hilos() const {
+            return this->trabajadores.size() + 1;
+        }
+        const vector<Sistema> &getSistemas() const {
+            return this->sistemas;
+        }
+        // Índices de los sistemas de cada etapa
+        const vector<vector<size_t>> &getEtapas() const {
+            return this->etapas;
+        }
+    private:
+        struct Tarea {
+            const function<void(size_t, size_t)> *ejecutar;
+            size_t inicio;
+            size_t fin;
+        };
+
+        vector<Sistema> sistemas;
+        vector<vector<size_t>> etapas;
+        size_t tamanioBloque;
+
+        vector<thread> trabajadores;
+        mutex m;
+        condition_variable hayTrabajo;
+        condition_variable terminado;
+        vector<Tarea> tareas;
+        atomic<size_t> siguiente{0};
+        uint64_t generacion = 0;
+        unsigned ocupados = 0;
+        bool detener = false;
+
+        void partir(const function<void(size_t, size_t)> &f, size_t n, vector<Tarea> &tareas) const {
+            for (size_t inicio = 0; inicio < n; inicio += this->tamanioBloque) {
+                tareas.push_back({ &f, inicio, min(n, inicio + this->tamanioBloque) });
+            }
+        }
+
+        // Toma tareas de la cola compartida hasta que no quede ninguna
+        void correrTareas() {
+            while (true) {
+                size_t i = this->siguiente.fetch_add(1, memory_order_relaxed);
+                if (i >= this->tareas.size()) return;
+                const Tarea &tarea = this->tareas[i];
+                (*tarea.ejecutar)(tarea.inicio, tarea.fin);
+            }
+        }
+
+        /**
+         * Publica las tareas, ayuda a ejecutarlas y espera a que los demás
+         * hilos terminen (barrera). Un hilo que despierta tarde puede seguir
+         * dentro de correrTareas(), por eso antes de reemplazar la cola se
+         * espera a que ningún hilo esté ocupado.
+         */
+        void lanzar(vector<Tarea> tareas) {
+            if (tareas.empty()) return;
+            {
+                unique_lock<mutex> candado(this->m);
+                this->terminado.wait(candado, [this]() { return this->ocupados == 0; });
+                this->tareas = move(tareas);
+                this->siguiente.store(0, memory_order_relaxed);
+                this->generacion++;
+            }
+            this->hayTrabajo.notify_all();
+            this->correrTareas();
+            unique_lock<mutex> candado(this->m);
+            this->terminado.wait(candado, [this]() { return this->ocupados == 0; });
+        }
+
+        void trabajar() {
+            uint64_t vista = 0;
+            unique_lock<mutex> candado(this->m);
+            while (true) {
+                this->hayTrabajo.wait(candado, [&]() { return this->detener || this->generacion != vista; });
+                if (this->detener) return;
+                vista = this->generacion;
+                this->ocupados++;
+                candado.unlock();
+                this->correrTareas();
+                candado.lock();
+                if (--this->ocupados == 0) this->terminado.notify_all();
+            }
+        }
+};
+
+#endif
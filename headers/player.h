@@ -1,6 +1,7 @@
 // Otras bibliotecas
 #include <iostream>
 #include <string>
+#include "cadenas.h"
 
 using namespace std;
 
@@ -20,18 +21,33 @@ using namespace std;
 #ifndef PLAYER_H
 #define PLAYER_H
 
+/**
+ * El nombre de un jugador se guarda dentro del mismo objeto (hasta 23
+ * caracteres), así crear o copiar un Player no reserva memoria dinámica.
+ * Los nombres más largos se siguen aceptando: se derraman al interner.
+ */
+typedef CadenaDerramable<23> NombreJugador;
+
 class Player {
     public:
-        string name;
+        NombreJugador name;
         int power;
-        Player(string name) {
+        // Posición en el mapa, para consultas de alcance y colisión
+        float x = 0;
+        float y = 0;
+        Player(NombreJugador name) {
             this->name = name;
             this->power = 10;
         }
-        Player(string name, int power) {
+        Player(NombreJugador name, int power) {
             this->name = name;
             this->power = power;
         }
+        // Compara distancias al cuadrado para evitar la raíz cuadrada
+        bool enRango(const Player &otro, float alcance) const {
+            float dx = this->x - otro.x, dy = this->y - otro.y;
+            return dx * dx + dy * dy <= alcance * alcance;
+        }
         void attack() {
             cout << "Jugador " << this->name << " ataca con " << this->power << " de poder." << endl;
         }
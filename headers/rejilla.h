@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "planificador.h"
+
+using namespace std;
+
+/**
+ * Rejilla espacial uniforme (spatial hash) para consultas de alcance.
+ *
+ * Revisar para cada jugador a todos los demás cuesta O(n²): con un millón de
+ * jugadores son 10^12 comparaciones. La rejilla divide el mapa en celdas del
+ * tamaño del alcance; los vecinos de un punto solo pueden estar en su celda o
+ * en las celdas que rodean al círculo de búsqueda.
+ *
+ * Como las entidades se mueven en cada paso, la rejilla se reconstruye con un
+ * ordenamiento por conteo (counting sort), O(n + celdas):
+ *
+ *   1. celda de cada entidad                  (en paralelo, por bloques)
+ *   2. cuántas entidades caen en cada celda   (histograma)
+ *   3. suma de prefijos: inicio de cada celda en el arreglo final
+ *   4. copiar cada entidad a su lugar         (entradas ordenadas por celda)
+ *
+ * Las entradas guardan una copia de la posición junto al id, así que recorrer
+ * una celda lee memoria contigua.
+ *
+ * construir() hace todo. Para correrla dentro de otro paso en paralelo (como
+ * los sistemas de batalla.h), las fases están separadas: preparar(),
+ * calcularCeldas() por bloques y ordenar() (pasos 2 a 4) en un solo hilo.
+ */
+#ifndef REJILLA_H
+#define REJILLA_H
+
+class RejillaEspacial {
+    public:
+        struct Entrada {
+            float x;
+            float y;
+            uint32_t id;
+        };
+
+        // Mapa cuadrado de [0, lado) x [0, lado); las posiciones fuera se pegan al borde
+        RejillaEspacial(float lado, float tamanioCelda) {
+            this->tamanioCelda = tamanioCelda;
+            this->inversoCelda = 1.0f / tamanioCelda;
+            this->columnas = max<uint32_t>(1, uint32_t(lado / tamanioCelda + 0.999f));
+            this->inicio.assign(size_t(this->columnas) * this->columnas + 1, 0);
+        }
+
+        void construir(const float *x, const float *y, size_t n, Planificador *planificador = nullptr) {
+            this->preparar(n);
+            auto calcularCeldas = [&](size_t desde, size_t hasta) { this->calcularCeldas(x, y, desde, hasta); };
+            if (planificador != nullptr) planificador->paraBloques(n, calcularCeldas);
+            else calcularCeldas(0, n);
+            this->ordenar(x, y, n);
+        }
+
+        // Fases de construir() por separado
+        void preparar(size_t n) {
+            this->celda.resize(n);
+        }
+        void calcularCeldas(const float *x, const float *y, size_t desde, size_t hasta) {
+            for (size_t i = desde; i < hasta; i++) this->celda[i] = this->celdaDe(x[i], y[i]);
+        }
+        void ordenar(const float *x, const float *y, size_t n) {
+            // Histograma en inicio[c + 1] y suma de prefijos: inicio[c] es donde empieza la celda c
+            fill(this->inicio.begin(), this->inicio.end(), 0);
+            for (size_t i = 0; i < n; i++) this->inicio[this->celda[i] + 1]++;
+            for (size_t c = 1; c < this->inicio.size(); c++) this->inicio[c] += this->inicio[c - 1];
+
+            // Al copiar, inicio[c] avanza hasta el inicio de la celda c + 1...
+            this->entradas.resize(n);
+            for (size_t i = 0; i < n; i++) {
+                this->entradas[this->inicio[this->celda[i]]++] = { x[i], y[i], uint32_t(i) };
+            }
+            // ...así que se recorre una posición para recuperar los inicios
+            memmove(&this->inicio[1], &this->inicio[0], (this->inicio.size() - 1) * sizeof(uint32_t));
+            this->inicio[0] = 0;
+        }
+
+        /**
+         * Llama a f(id) por cada entidad a distancia <= radio de (x, y),
+         * incluyendo a la entidad que esté en ese mismo punto.
+         */
+        template <typename Funcion>
+        void paraCadaVecino(float x, float y, float radio, Funcion f) const {
+            uint32_t x0 = this->indice(x - radio), x1 = this->indice(x + radio);
+            uint32_t y0 = this->indice(y - radio), y1 = this->indice(y + radio);
+            float radio2 = radio * radio;
+            for (uint32_t cy = y0; cy <= y1; cy++) {
+                // Las celdas de una misma fila son contiguas en 'entradas'
+                uint32_t desde = this->inicio[cy * this->columnas + x0];
+                uint32_t hasta = this->inicio[cy * this->columnas + x1 + 1];
+                for (uint32_t e = desde; e < hasta; e++) {
+                    const Entrada &entrada = this->entradas[e];
+                    float dx = entrada.x - x, dy = entrada.y - y;
+                    if (dx * dx + dy * dy <= radio2) f(entrada.id);
+                }
+            }
+        }
+        size_t contarVecinos(float x, float y, float radio) const {
+            size_t total = 0;
+            this->paraCadaVecino(x, y, radio, [&total](uint32_t) { total++; });
+            return total;
+        }
+
+        /**
+         * Entradas en orden de celda. Consultar en este orden (en lugar del orden
+         * de los ids) hace que consultas seguidas lean las mismas celdas, que
+         * ya están en caché.
+         */
+        const Entrada &entrada(size_t e) const {
+            return this->entradas[e];
+        }
+        uint32_t getColumnas() const {
+            return this->columnas;
+        }
+        size_t size() const {
+            return this->entradas.size();
+        }
+    private:
+        float tamanioCelda;
+        float inversoCelda;
+        uint32_t columnas;
+        // Inicio de cada celda en 'entradas' (columnas² + 1 valores)
+        vector<uint32_t> inicio;
+        vector<uint32_t> celda;
+        vector<Entrada> entradas;
+
+        uint32_t indice(float coordenada) const {
+            float c = coordenada * this->inversoCelda;
+            if (!(c > 0)) return 0;
+            if (c >= float(this->columnas)) return this->columnas - 1;
+            return uint32_t(c);
+        }
+        uint32_t celdaDe(float x, float y) const {
+            return this->indice(y) * this->columnas + this->indice(x);
+        }
+};
+
+#endif
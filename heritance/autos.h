@@ -0,0 +1,173 @@
+#include <iostream>
+#include <string>
+/**
+ * Textos internados: cada marca o modelo distinto se guarda una sola vez y
+ * cada auto solo almacena un id de 32 bits.
+ */
+#include "../headers/cadenas.h"
+/**
+ * Contadores seguros para múltiples hilos sin competir por una sola línea de caché.
+ */
+#include "contadores.h"
+
+using namespace std;
+
+/**
+ * Jerarquía de autos del ejemplo de herencia. Vive en su propio archivo de
+ * cabecera para poder reutilizarla desde los benchmarks (bench.cpp).
+ */
+#ifndef AUTOS_H
+#define AUTOS_H
+
+class Auto : private InstanciaContada<Auto> {
+    public:
+        CadenaInterna marca;
+        CadenaInterna modelo;
+        /**
+         * El modificador static tiene el mismo comportamiento que en cualquier
+         * otro lenguaje de programación que soporte POO.
+         * 
+         * Este modificador establece a un miembro de la clase apuntando siempre
+         * a la misma dirección de memoria sin importar cuantas instancias se
+         * generen. En todas las instancias, esta miembro siempre será el mismo.
+         * 
+         * Antes de C++17 solo se podía declarar al miembro dentro de la clase y
+         * había que definirlo por fuera (int Auto::llantas = 4;) en un único
+         * .cpp. Esta clase vive en una cabecera incluida desde varios archivos,
+         * así que se usa 'inline static': la definición va aquí mismo y el
+         * enlazador conserva una sola copia.
+         */
+        inline static int llantas = 4;
+        /**
+         * Un 'static int' no es seguro si varios hilos crean autos a la vez, por
+         * lo que el contador es un ContadorDistribuido (ver contadores.h) que
+         * conserva la misma sintaxis (contador++).
+         */
+        inline static ContadorDistribuido contador;
+        // Instancias vivas y creadas, mantenidas por la base InstanciaContada
+        inline static EstadisticasInstancias instancias;
+        Auto(CadenaInterna marca, CadenaInterna modelo) {
+            this->marca = marca;
+            this->modelo = modelo;
+            contador++;
+        }
+        bool encendido = false;
+        void encender();
+    /**
+     * El modificador protected expone miembros de la clase accesibles desde la
+     * clase que los define (esta) y la clase que extiendan de la misma, pero bloqueando
+     * el acceso desde las instancias generadas.
+     */
+    protected:
+        bool usado = false;
+};
+
+/**
+ * C++ ofrece el operador de resolución de alcance (::), que entre otras
+ * cosas, permite definir a un miembro de clase por fuera de la misma.
+ * 
+ * Más información del operador:
+ * + https://www.geeksforgeeks.org/scope-resolution-operator-in-c/
+ *
+ * Por estar en una cabecera, la definición lleva inline (las funciones
+ * definidas dentro de la clase ya lo son): sin él, dos .cpp que incluyan
+ * autos.h tendrían cada uno su propia copia y el enlazador los rechazaría.
+ */
+inline void Auto::encender() {
+    this->encendido = true;
+    cout << this->marca << " " << this->modelo << " de " << this->llantas << " llantas arrancando..." << endl;
+}
+
+/**
+ * La sintaxis para definir una clase que extienda de otra clase
+ * es mediante el operador :, simil a extends en otros lenguajes de programación
+ * como Dart, Javascript o Java.
+ * 
+ * Todos los miembros public y protected serán extendidos a esta nueva clase.
+ * 
+ * Una característica particular de C++ es que se puede definir una capa de
+ * acceso encima de la herencia. Es decir, establecer un modificador de acceso
+ * a la clase heredada en cuestión. Si se omite este modificador, por defecto
+ * queda expuesta con public.
+ */
+class Sedan : public Auto, private InstanciaContada<Sedan> {
+    public:
+        int puertas = 4;
+        string color;
+        /**
+         * A diferencia de otros lenguajes donde la keyword super llama al
+         * constructor de la clase padre, en C++ se utiliza la sintaxis de
+         * dos puntos (:).
+         */
+        Sedan(CadenaInterna marca, CadenaInterna modelo, string color) : Auto(marca, modelo) {
+            this->color = move(color);
+            this->usado = true;
+        }
+        inline static EstadisticasInstancias instancias;
+        void derrapar() {
+            cout << "El sedan " << this->marca << " " << this->modelo << " está derrapando!" << endl;
+        }
+};
+
+/**
+ * Rasgo (mixin) de los autos con motor deportivo. No hereda de Auto: solo
+ * agrega el dato del motor a las clases que lo incluyan. De esta forma se
+ * compone la característica sin arrastrar una segunda copia de Auto.
+ */
+class MotorDeportivo {
+    public:
+        string motor;
+        MotorDeportivo(string motor) {
+            this->motor = move(motor);
+        }
+};
+
+/**
+ * El orden de las clases base también es el orden en memoria: colocando primero
+ * MotorDeportivo (alineado a 8 bytes), Auto y puertas (alineados a 4) quedan
+ * juntos al final sin relleno intermedio.
+ */
+class Coupe : public MotorDeportivo, public Auto, private InstanciaContada<Coupe> {
+    public:
+        int puertas = 2;
+        Coupe(CadenaInterna marca, CadenaInterna modelo, string motor) : MotorDeportivo(move(motor)), Auto(marca, modelo) {}
+        inline static EstadisticasInstancias instancias;
+};
+
+/**
+ * Existirán casos de uso donde se necesite heredar de múltiples clases
+ * a la vez.
+ *
+ * Originalmente Hatchback heredaba de Sedan y de Coupe, y como ambas extienden
+ * de Auto se formaba un "diamante": cada Hatchback cargaba dos subobjetos Auto
+ * completos (dos marcas, dos modelos, dos banderas usado) y el contador de Auto
+ * se incrementaba dos veces por instancia.
+ *
+ * La herencia virtual (class Sedan : virtual public Auto) comparte un solo Auto,
+ * pero agrega un puntero oculto de 8 bytes a Sedan y a Coupe; con un Auto tan
+ * compacto (ids de 12 bytes) el objeto termina siendo más grande. Por eso aquí se
+ * usa composición: Hatchback es un Sedan que además incluye el rasgo
+ * MotorDeportivo. Sigue siendo herencia múltiple, pero Auto existe una sola vez.
+ * El reporte de disposición en memoria está en bench.cpp.
+ */
+class Hatchback : public Sedan, public MotorDeportivo, private InstanciaContada<Hatchback> {
+    public:
+        Hatchback(
+            CadenaInterna marca,
+            CadenaInterna modelo,
+            string color,
+            string motor
+        ) : Sedan(marca, modelo, move(color)), MotorDeportivo(move(motor)) {}
+        inline static EstadisticasInstancias instancias;
+        void describir() {
+            /**
+             * Con el diamante, llamar a "marca" era ambiguo y había que indicar con el
+             * operador de resolución de alcance (::) a cuál copia de Auto se refería
+             * (Sedan::marca o Coupe::marca). Ahora solo hay un Auto y no hay ambigüedad,
+             * aunque el operador sigue siendo válido para indicar de dónde viene un miembro.
+             */
+            cout << "Soy un hatckback " << this->marca << " " << Sedan::modelo << " de motor " << MotorDeportivo::motor << endl;
+        }
+};
+
+#endif
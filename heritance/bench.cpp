@@ -0,0 +1,304 @@
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "autos.h"
+#include "contadores.h"
+#include "disposicion.h"
+#include "flota.h"
+#include "../headers/mapa_ranuras.h"
+
+using namespace std;
+
+/**
+ * Lanza 'hilos' hilos que incrementan 'n' veces cada uno y reporta millones
+ * de incrementos por segundo y el valor final (debería ser hilos * n).
+ */
+template <typename Incrementar, typename Leer>
+void medir(const char *nombre, unsigned hilos, long long n, Incrementar incrementar, Leer leer) {
+    vector<thread> trabajadores;
+    auto inicio = chrono::steady_clock::now();
+    for (unsigned h = 0; h < hilos; h++) {
+        trabajadores.emplace_back([&]() {
+            for (long long i = 0; i < n; i++) incrementar();
+        });
+    }
+    for (thread &t : trabajadores) t.join();
+    chrono::duration<double> segundos = chrono::steady_clock::now() - inicio;
+    cout << nombre << ": " << hilos * n / segundos.count() / 1e6 << " M incrementos/s, valor final "
+         << leer() << " de " << hilos * n << endl;
+}
+
+/**
+ * Réplicas de la jerarquía con los mismos miembros que autos.h, para comparar
+ * la disposición en memoria de las alternativas al diamante.
+ */
+namespace diamante {
+    struct Auto {
+        CadenaInterna marca, modelo;
+        bool usado = false;
+        bool encendido = false;
+        Auto(CadenaInterna marca, CadenaInterna modelo) : marca(marca), modelo(modelo) {
+            ::Auto::contador++;
+            ::Auto::instancias.creada();
+        }
+    };
+    struct Sedan : Auto {
+        int puertas = 4;
+        string color;
+        Sedan(CadenaInterna ma, CadenaInterna mo, string c) : Auto(ma, mo), color(move(c)) { ::Sedan::instancias.creada(); }
+    };
+    struct Coupe : Auto {
+        int puertas = 2;
+        string motor;
+        Coupe(CadenaInterna ma, CadenaInterna mo, string m) : Auto(ma, mo), motor(move(m)) { ::Coupe::instancias.creada(); }
+    };
+    // Dos subobjetos Auto y dos incrementos del contador
+    struct Hatchback : Sedan, Coupe {
+        Hatchback(CadenaInterna ma, CadenaInterna mo, string c, string m) : Sedan(ma, mo, move(c)), Coupe(ma, mo, move(m)) { ::Hatchback::instancias.creada(); }
+    };
+}
+
+namespace virtual_ {
+    struct Auto {
+        CadenaInterna marca, modelo;
+        bool usado = false;
+        bool encendido = false;
+        Auto(CadenaInterna marca, CadenaInterna modelo) : marca(marca), modelo(modelo) {
+            ::Auto::contador++;
+            ::Auto::instancias.creada();
+        }
+    };
+    struct Sedan : virtual Auto {
+        int puertas = 4;
+        string color;
+        Sedan(CadenaInterna ma, CadenaInterna mo, string c) : Auto(ma, mo), color(move(c)) { ::Sedan::instancias.creada(); }
+    };
+    struct Coupe : virtual Auto {
+        int puertas = 2;
+        string motor;
+        Coupe(CadenaInterna ma, CadenaInterna mo, string m) : Auto(ma, mo), motor(move(m)) { ::Coupe::instancias.creada(); }
+    };
+    // La clase más derivada construye al único Auto compartido
+    struct Hatchback : Sedan, Coupe {
+        Hatchback(CadenaInterna ma, CadenaInterna mo, string c, string m) : Auto(ma, mo), Sedan(ma, mo, move(c)), Coupe(ma, mo, move(m)) { ::Hatchback::instancias.creada(); }
+    };
+}
+
+static_assert(sizeof(Hatchback) < sizeof(diamante::Hatchback), "El Hatchback compuesto debe ocupar menos memoria que el diamante");
+static_assert(sizeof(Hatchback) < sizeof(virtual_::Hatchback), "El Hatchback compuesto debe ocupar menos memoria que la herencia virtual");
+
+template <typename T>
+void medirConstruccion(const char *nombre) {
+    const int N = 2000000;
+    CadenaInterna marca = "Mazda", modelo = "3";
+    long long antes = Auto::contador;
+    vector<T> autos;
+    autos.reserve(N);
+    auto inicio = chrono::steady_clock::now();
+    for (int i = 0; i < N; i++) autos.emplace_back(marca, modelo, "Gris espacial", "2.5 lt");
+    chrono::duration<double> segundos = chrono::steady_clock::now() - inicio;
+    cout << nombre << ": " << N / segundos.count() / 1e6 << " M construcciones/s, "
+         << double(Auto::contador - antes) / N << " incrementos de Auto::contador por objeto" << endl;
+}
+
+void benchDisposicion() {
+    const size_t AUTO = 2 * sizeof(CadenaInterna) + 2 * sizeof(bool);
+    const size_t SEDAN = AUTO + sizeof(int) + sizeof(string);
+    reportarDisposicion<Auto>("Auto", AUTO);
+    reportarDisposicion<Sedan>("Sedan", SEDAN);
+    reportarDisposicion<Coupe>("Coupe", SEDAN);
+    reportarDisposicion<diamante::Hatchback>("Hatchback diamante (2 Auto)", 2 * SEDAN);
+    reportarDisposicion<virtual_::Hatchback>("Hatchback herencia virtual", SEDAN + sizeof(int) + sizeof(string));
+    reportarDisposicion<Hatchback>("Hatchback compuesto", SEDAN + sizeof(string));
+
+    cout << endl;
+    medirConstruccion<diamante::Hatchback>("Hatchback diamante");
+    medirConstruccion<virtual_::Hatchback>("Hatchback herencia virtual");
+    medirConstruccion<Hatchback>("Hatchback compuesto");
+}
+
+/**
+ * Recorridos masivos: vector<Auto*> con objetos creados uno a uno con new
+ * (y en orden mezclado, como queda el heap tras muchas altas y bajas) contra
+ * Flota con un vector contiguo por tipo.
+ */
+void benchFlota() {
+    const int N = 1000000;
+    const int REPETICIONES = 20;
+    CadenaInterna marca = "Mazda", modelo = "3";
+
+    vector<Auto *> punteros;
+    vector<Auto *> autos;
+    vector<Sedan *> sedanes;
+    vector<Coupe *> coupes;
+    vector<Hatchback *> hatchbacks;
+    Flota flota;
+    for (int i = 0; i < N; i++) {
+        switch (i % 4) {
+            case 0: autos.push_back(new Auto(marca, modelo)); punteros.push_back(autos.back()); flota.agregar<Auto>(marca, modelo); break;
+            case 1: sedanes.push_back(new Sedan(marca, modelo, "Rojo")); punteros.push_back(sedanes.back()); flota.agregar<Sedan>(marca, modelo, "Rojo"); break;
+            case 2: coupes.push_back(new Coupe(marca, modelo, "2.0 lt")); punteros.push_back(coupes.back()); flota.agregar<Coupe>(marca, modelo, "2.0 lt"); break;
+            case 3: hatchbacks.push_back(new Hatchback(marca, modelo, "Gris", "1.6 lt")); punteros.push_back(hatchbacks.back()); flota.agregar<Hatchback>(marca, modelo, "Gris", "1.6 lt"); break;
+        }
+    }
+    shuffle(punteros.begin(), punteros.end(), mt19937(3));
+
+    auto tiempo = [](auto funcion) {
+        auto inicio = chrono::steady_clock::now();
+        for (int r = 0; r < REPETICIONES; r++) funcion();
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / (double(N) * REPETICIONES);
+    };
+    size_t encendidosPunteros = 0, encendidosFlota = 0;
+
+    double encenderPunteros = tiempo([&]() { for (Auto *a : punteros) a->encendido = !a->encendido; });
+    double encenderFlota = tiempo([&]() { flota.paraTodos([](Auto &a) { a.encendido = !a.encendido; }); });
+    double contarPunteros = tiempo([&]() { for (Auto *a : punteros) encendidosPunteros += a->encendido; });
+    double contarFlota = tiempo([&]() { encendidosFlota += flota.contarEncendidos(); });
+
+    cout << "Recorrido de " << N << " autos\tvector<Auto*>\tFlota" << endl;
+    cout << "encender (ns/auto)\t\t" << encenderPunteros << "\t\t" << encenderFlota << endl;
+    cout << "contar encendidos (ns/auto)\t" << contarPunteros << "\t\t" << contarFlota
+         << (encendidosPunteros == encendidosFlota ? "" : "  (!)") << endl;
+
+    // Sin destructor virtual, cada objeto se libera con su tipo concreto
+    for (Auto *a : autos) delete a;
+    for (Sedan *a : sedanes) delete a;
+    for (Coupe *a : coupes) delete a;
+    for (Hatchback *a : hatchbacks) delete a;
+}
+
+/**
+ * Altas y bajas constantes (churn) con un millón de sedanes vivos: objetos
+ * sueltos con new/delete, una tabla unordered_map<id, Sedan> y MapaRanuras.
+ * Las tres variantes reciben la misma secuencia de posiciones aleatorias.
+ */
+void benchRanuras() {
+    const size_t N = 1000000, CAMBIOS = 5000000, CONSULTAS = 10000000, RECORRIDOS = 20;
+    CadenaInterna marca = "Mazda", modelo = "3";
+
+    mt19937 aleatorio(7);
+    vector<uint32_t> posiciones(max(CAMBIOS, CONSULTAS));
+    for (uint32_t &p : posiciones) p = aleatorio() % N;
+
+    auto ns = [](chrono::steady_clock::time_point inicio, size_t operaciones) {
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / operaciones;
+    };
+    cout << "Churn con " << N << " sedanes\tnew/delete\tunordered_map\tMapaRanuras" << endl;
+    double cambios[3], consultas[3], recorridos[3];
+    size_t encendidos[3] = { 0, 0, 0 };
+
+    {
+        vector<Sedan *> vivos;
+        for (size_t i = 0; i < N; i++) vivos.push_back(new Sedan(marca, modelo, "Rojo"));
+        auto inicio = chrono::steady_clock::now();
+        for (size_t c = 0; c < CAMBIOS; c++) {
+            delete vivos[posiciones[c]];
+            vivos[posiciones[c]] = new Sedan(marca, modelo, "Rojo");
+        }
+        cambios[0] = ns(inicio, CAMBIOS);
+        inicio = chrono::steady_clock::now();
+        for (size_t c = 0; c < CONSULTAS; c++) vivos[posiciones[c]]->encendido ^= true;
+        consultas[0] = ns(inicio, CONSULTAS);
+        inicio = chrono::steady_clock::now();
+        for (size_t r = 0; r < RECORRIDOS; r++) for (Sedan *s : vivos) encendidos[0] += s->encendido;
+        recorridos[0] = ns(inicio, N * RECORRIDOS);
+        for (Sedan *s : vivos) delete s;
+    }
+    {
+        unordered_map<uint64_t, Sedan> tabla;
+        vector<uint64_t> vivos;
+        uint64_t siguienteId = 0;
+        tabla.reserve(N);
+        for (size_t i = 0; i < N; i++) {
+            tabla.emplace(piecewise_construct, forward_as_tuple(siguienteId), forward_as_tuple(marca, modelo, "Rojo"));
+            vivos.push_back(siguienteId++);
+        }
+        auto inicio = chrono::steady_clock::now();
+        for (size_t c = 0; c < CAMBIOS; c++) {
+            tabla.erase(vivos[posiciones[c]]);
+            tabla.emplace(piecewise_construct, forward_as_tuple(siguienteId), forward_as_tuple(marca, modelo, "Rojo"));
+            vivos[posiciones[c]] = siguienteId++;
+        }
+        cambios[1] = ns(inicio, CAMBIOS);
+        inicio = chrono::steady_clock::now();
+        for (size_t c = 0; c < CONSULTAS; c++) tabla.find(vivos[posiciones[c]])->second.encendido ^= true;
+        consultas[1] = ns(inicio, CONSULTAS);
+        inicio = chrono::steady_clock::now();
+        for (size_t r = 0; r < RECORRIDOS; r++) for (auto &par : tabla) encendidos[1] += par.second.encendido;
+        recorridos[1] = ns(inicio, N * RECORRIDOS);
+    }
+    {
+        MapaRanuras<Sedan> mapa;
+        vector<Manejador> vivos;
+        mapa.reservar(N);
+        for (size_t i = 0; i < N; i++) vivos.push_back(mapa.insertar(marca, modelo, "Rojo"));
+        auto inicio = chrono::steady_clock::now();
+        for (size_t c = 0; c < CAMBIOS; c++) {
+            mapa.eliminar(vivos[posiciones[c]]);
+            vivos[posiciones[c]] = mapa.insertar(marca, modelo, "Rojo");
+        }
+        cambios[2] = ns(inicio, CAMBIOS);
+        inicio = chrono::steady_clock::now();
+        for (size_t c = 0; c < CONSULTAS; c++) mapa.obtener(vivos[posiciones[c]])->encendido ^= true;
+        consultas[2] = ns(inicio, CONSULTAS);
+        inicio = chrono::steady_clock::now();
+        for (size_t r = 0; r < RECORRIDOS; r++) for (const Sedan &s : mapa) encendidos[2] += s.encendido;
+        recorridos[2] = ns(inicio, N * RECORRIDOS);
+    }
+
+    cout << "baja + alta (ns)\t\t" << cambios[0] << "\t\t" << cambios[1] << "\t\t" << cambios[2] << endl;
+    cout << "acceso por manejador (ns)\t" << consultas[0] << "\t\t" << consultas[1] << "\t\t" << consultas[2] << endl;
+    cout << "recorrido (ns/sedán)\t\t" << recorridos[0] << "\t\t" << recorridos[1] << "\t\t" << recorridos[2]
+         << (encendidos[0] == encendidos[1] && encendidos[1] == encendidos[2] ? "" : "  (!)") << endl;
+}
+
+int main() {
+
+    benchDisposicion();
+    cout << endl;
+
+    benchFlota();
+    cout << endl;
+
+    benchRanuras();
+    cout << endl;
+
+    const unsigned HILOS = 32;
+    const long long N = 2000000;
+    cout << HILOS << " hilos en " << thread::hardware_concurrency() << " núcleos" << endl;
+
+    // 'volatile' evita que el compilador junte los incrementos; aun así se pierden por la carrera
+    static volatile int contadorInseguro = 0;
+    medir("static int (inseguro)", HILOS, N,
+        []() { contadorInseguro = contadorInseguro + 1; },
+        []() { return (long long) contadorInseguro; }
+    );
+
+    static atomic<int> contadorAtomico{0};
+    medir("std::atomic<int>", HILOS, N,
+        []() { contadorAtomico.fetch_add(1, memory_order_relaxed); },
+        []() { return (long long) contadorAtomico.load(); }
+    );
+
+    static ContadorDistribuido contadorDistribuido;
+    medir("ContadorDistribuido", HILOS, N,
+        []() { contadorDistribuido++; },
+        []() { return contadorDistribuido.valor(); }
+    );
+
+    // Leer es más caro que incrementar: suma todos los fragmentos
+    const int LECTURAS = 1000000;
+    volatile long long ultimo = 0;
+    auto inicio = chrono::steady_clock::now();
+    for (int i = 0; i < LECTURAS; i++) ultimo = contadorDistribuido.valor();
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / LECTURAS;
+    cout << "Lectura de ContadorDistribuido: " << ns << " ns (" << ContadorDistribuido::FRAGMENTOS
+         << " fragmentos, valor " << ultimo << ")" << endl;
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * Contadores estadísticos para muchos hilos.
+ *
+ * Un 'static int' incrementado desde varios hilos a la vez pierde incrementos
+ * (no es seguro). Un único std::atomic<int> sí es seguro, pero todos los
+ * núcleos pelean por la misma línea de caché (64 bytes) y cada incremento
+ * tiene que esperar a que la línea viaje de un núcleo a otro.
+ *
+ * ContadorDistribuido reparte el valor en varios fragmentos (shards), cada uno
+ * en su propia línea de caché. Cada hilo incrementa siempre el mismo
+ * fragmento, y leer el total suma todos los fragmentos. Es ideal para valores
+ * que se incrementan muy seguido pero se leen pocas veces.
+ */
+#ifndef CONTADORES_H
+#define CONTADORES_H
+
+class ContadorDistribuido {
+    public:
+        static constexpr unsigned FRAGMENTOS = 64;
+
+        ContadorDistribuido() = default;
+        ContadorDistribuido(const ContadorDistribuido &) = delete;
+        ContadorDistribuido &operator=(const ContadorDistribuido &) = delete;
+
+        void sumar(long long n) {
+            // relaxed: solo importa el valor final, no el orden respecto a otras variables
+            fragmentos[indiceHilo()].valor.fetch_add(n, memory_order_relaxed);
+        }
+        void operator++(int) {
+            this->sumar(1);
+        }
+        void operator--(int) {
+            this->sumar(-1);
+        }
+
+        long long valor() const {
+            long long total = 0;
+            for (const Fragmento &f : fragmentos) total += f.valor.load(memory_order_relaxed);
+            return total;
+        }
+        operator long long() const {
+            return this->valor();
+        }
+    private:
+        struct alignas(64) Fragmento {
+            atomic<long long> valor{0};
+        };
+        Fragmento fragmentos[FRAGMENTOS];
+
+        // Cada hilo recibe un fragmento fijo la primera vez que incrementa algún contador
+        static unsigned indiceHilo() {
+            static atomic<unsigned> siguiente{0};
+            thread_local unsigned indice = siguiente.fetch_add(1, memory_order_relaxed) % FRAGMENTOS;
+            return indice;
+        }
+};
+
+/**
+ * Instancias vivas (creadas - destruidas) y totales (creadas) de una clase.
+ */
+struct EstadisticasInstancias {
+    ContadorDistribuido vivas;
+    ContadorDistribuido totales;
+
+    void creada() {
+        vivas++;
+        totales++;
+    }
+    void destruida() {
+        vivas--;
+    }
+};
+
+/**
+ * Clase base vacía que mantiene las estadísticas de T::instancias. Al heredar
+ * de ella, los constructores (incluyendo los de copia y movimiento que genera
+ * el compilador) y el destructor de T actualizan los contadores solos, por
+ * ejemplo cuando un vector<T> mueve sus elementos al crecer.
+ *
+ * Al no tener miembros, el compilador no le asigna espacio dentro de T
+ * (optimización de base vacía).
+ */
+template <typename T>
+class InstanciaContada {
+    protected:
+        InstanciaContada() {
+            T::instancias.creada();
+        }
+        InstanciaContada(const InstanciaContada &) {
+            T::instancias.creada();
+        }
+        InstanciaContada &operator=(const InstanciaContada &) = default;
+        ~InstanciaContada() {
+            T::instancias.destruida();
+        }
+};
+
+inline ostream &operator<<(ostream &salida, const EstadisticasInstancias &e) {
+    return salida << e.vivas.valor() << " vivas, " << e.totales.valor() << " creadas";
+}
+
+#endif
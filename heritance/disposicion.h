@@ -0,0 +1,46 @@
+#include <cstddef>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * Reporte de disposición en memoria (layout) de un tipo.
+ *
+ * El compilador agrega relleno (padding) entre miembros para respetar la
+ * alineación de cada uno, y la herencia virtual agrega punteros ocultos. Este
+ * reporte compara el tamaño real (sizeof) contra los bytes de datos declarados
+ * y cuenta cuántas líneas de caché (64 bytes) toca un objeto.
+ */
+#ifndef DISPOSICION_H
+#define DISPOSICION_H
+
+const size_t LINEA_CACHE = 64;
+
+// Líneas de caché que ocupa un objeto de 'tamanio' bytes que empieza en 'desplazamiento'
+constexpr size_t lineasCache(size_t tamanio, size_t desplazamiento = 0) {
+    return (desplazamiento % LINEA_CACHE + tamanio + LINEA_CACHE - 1) / LINEA_CACHE;
+}
+
+// Peor caso: el objeto puede empezar en cualquier dirección múltiplo de su alineación
+constexpr size_t lineasCachePeorCaso(size_t tamanio, size_t alineacion) {
+    size_t peor = 0;
+    for (size_t d = 0; d < LINEA_CACHE; d += alineacion) {
+        size_t lineas = lineasCache(tamanio, d);
+        if (lineas > peor) peor = lineas;
+    }
+    return peor;
+}
+
+/**
+ * 'bytesDatos' es la suma de sizeof de los miembros declarados (incluyendo los
+ * heredados); lo que sobra es relleno o punteros ocultos.
+ */
+template <typename T>
+void reportarDisposicion(const char *nombre, size_t bytesDatos) {
+    cout << nombre << ": sizeof " << sizeof(T) << " B, alignof " << alignof(T)
+         << ", datos " << bytesDatos << " B, relleno/ocultos " << sizeof(T) - bytesDatos
+         << " B, líneas de caché " << lineasCache(sizeof(T)) << " (peor caso "
+         << lineasCachePeorCaso(sizeof(T), alignof(T)) << ")" << endl;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "autos.h"
+
+using namespace std;
+
+/**
+ * Flota: contenedor de autos separado por tipo concreto.
+ *
+ * Con 'Auto *a = new Sedan(...)' cada objeto vive en un lugar distinto del
+ * heap, y recorrer un vector<Auto*> implica saltar de puntero en puntero
+ * (fallos de caché). Flota guarda cada tipo en su propio vector contiguo:
+ *
+ *   vector<Auto>       [ Auto | Auto | Auto | ... ]
+ *   vector<Sedan>      [ Sedan | Sedan | ... ]
+ *   vector<Coupe>      [ Coupe | ... ]
+ *   vector<Hatchback>  [ Hatchback | ... ]
+ *
+ * Las visitas recorren un tipo a la vez: el compilador conoce el tipo exacto
+ * de cada elemento, así que no hay punteros que seguir ni llamadas virtuales,
+ * y la función visitante puede expandirse en línea (inline).
+ */
+#ifndef FLOTA_H
+#define FLOTA_H
+
+template <typename... Tipos>
+class FlotaDe {
+    public:
+        // Construye el auto directamente dentro del vector de su tipo
+        template <typename T, typename... Args>
+        T &agregar(Args &&... args) {
+            return this->de<T>().emplace_back(forward<Args>(args)...);
+        }
+
+        template <typename T>
+        vector<T> &de() {
+            return get<vector<T>>(autos);
+        }
+        template <typename T>
+        const vector<T> &de() const {
+            return get<vector<T>>(autos);
+        }
+
+        template <typename T>
+        void reservar(size_t cantidad) {
+            this->de<T>().reserve(cantidad);
+        }
+
+        size_t size() const {
+            return (this->de<Tipos>().size() + ...);
+        }
+
+        // Visita solo los autos de tipo T
+        template <typename T, typename Funcion>
+        void paraCada(Funcion f) {
+            for (T &a : this->de<T>()) f(a);
+        }
+
+        /**
+         * Visita todos los autos, un tipo a la vez. La función recibe el tipo
+         * concreto, por lo que puede ser una lambda genérica ([](auto &a) {...})
+         * o una que reciba Auto & para operar sobre lo que todos comparten.
+         */
+        template <typename Funcion>
+        void paraTodos(Funcion f) {
+            (this->paraCada<Tipos>(f), ...);
+        }
+        template <typename Funcion>
+        void paraTodos(Funcion f) const {
+            ((void) [&]() { for (const Tipos &a : this->de<Tipos>()) f(a); }(), ...);
+        }
+
+        /**
+         * Operación masiva al estilo de encender(): marca todos los autos como
+         * encendidos sin imprimir un mensaje por cada uno.
+         */
+        void encenderTodos() {
+            this->paraTodos([](Auto &a) { a.encendido = true; });
+        }
+        size_t contarEncendidos() const {
+            size_t total = 0;
+            this->paraTodos([&total](const Auto &a) { total += a.encendido; });
+            return total;
+        }
+    private:
+        tuple<vector<Tipos>...> autos;
+};
+
+typedef FlotaDe<Auto, Sedan, Coupe, Hatchback> Flota;
+
+#endif
@@ -1,122 +1,16 @@
 #include <iostream>
 #include <string>
-
-using namespace std;
-
-class Auto {
-    public:
-        string marca;
-        string modelo;
-        /**
-         * El modificador static tiene el mismo comportamiento que en cualquier
-         * otro lenguaje de programación que soporte POO.
-         * 
-         * Este modificador establece a un miembro de la clase apuntando siempre
-         * a la misma dirección de memoria sin importar cuantas instancias se
-         * generen. En todas las instancias, esta miembro siempre será el mismo.
-         * 
-         * C++ no permite inicializar a un miembro estático, por lo que primero
-         * hay que declarar al miembro (ya sea una propiedad o función) y después
-         * definirlo por fuera de la clase.
-         */
-        static int llantas; // <-- Solo la declaración
-        static int contador;
-        Auto(string marca, string modelo) {
-            this->marca = marca;
-            this->modelo = modelo;
-            contador++;
-        }
-        void encender();
-    /**
-     * El modificador protected expone miembros de la clase accesibles desde la
-     * clase que los define (esta) y la clase que extiendan de la misma, pero bloqueando
-     * el acceso desde las instancias generadas.
-     */
-    protected:
-        bool usado = false;
-};
-
 /**
- * C++ ofrece el operador de resolución de alcance (::), que entre otras
- * cosas, permite definir a un miembro de clase por fuera de la misma.
- * 
- * Más información del operador:
- * + https://www.geeksforgeeks.org/scope-resolution-operator-in-c/
+ * La jerarquía Auto, Sedan, Coupe y Hatchback está definida en autos.h.
  */
-void Auto::encender() {
-    cout << this->marca << " " << this->modelo << " de " << this->llantas << " llantas arrancando..." << endl;
-}
-// En este caso, el operador es útil para definir también al miembro estático
-int Auto::llantas = 4;
-int Auto::contador = 0;
-
+#include "autos.h"
+#include "flota.h"
 /**
- * La sintaxis para definir una clase que extienda de otra clase
- * es mediante el operador :, simil a extends en otros lenguajes de programación
- * como Dart, Javascript o Java.
- * 
- * Todos los miembros public y protected serán extendidos a esta nueva clase.
- * 
- * Una característica particular de C++ es que se puede definir una capa de
- * acceso encima de la herencia. Es decir, establecer un modificador de acceso
- * a la clase heredada en cuestión. Si se omite este modificador, por defecto
- * queda expuesta con public.
+ * Almacenamiento con manejadores estables para autos que se crean y destruyen.
  */
-class Sedan : public Auto {
-    public:
-        int puertas = 4;
-        string color;
-        /**
-         * A diferencia de otros lenguajes donde la keyword super llama al
-         * constructor de la clase padre, en C++ se utiliza la sintaxis de
-         * dos puntos (:).
-         */
-        Sedan(string marca, string modelo, string color) : Auto(marca, modelo) {
-            this->color = color;
-            this->usado = true;
-        }
-        void derrapar() {
-            cout << "El sedan " << this->marca << " " << this->modelo << " está derrapando!" << endl;
-        }
-};
-
-class Coupe : public Auto {
-    public:
-        int puertas = 2;
-        string motor;
-        Coupe(string marca, string modelo, string motor) : Auto(marca, modelo) {
-            this->motor = motor;
-        }
-};
+#include "../headers/mapa_ranuras.h"
 
-/**
- * Existirán casos de uso donde se necesite heredar de múltiples clases
- * a la vez.
- */
-class Hatchback : public Sedan, public Coupe {
-    public:
-        Hatchback(
-            string marca,
-            string modelo,
-            string color,
-            string motor
-        ) : Sedan(marca, modelo, color), Coupe(marca, modelo, motor) {
-            // ...
-        }
-        void describir() {
-            /**
-             * Este ejemplo en particual es un poco problemático puesto que tanto la clase
-             * Sedan como Coupe extienden de la clase Auto, entonces Auto ha recibido dos
-             * constructores, por lo que llamar a una propiedad de auto como "marca" puede ser
-             * ambiguo para el compilador. Aprovechando el scope actual, el operador de resolución
-             * de alcance (::) puede identificar a qué propiedad estoy refiriendome en específico.
-             * 
-             * Como se puede ver, la propiedad "motor" solo existe en la clase Coupe, por lo que no
-             * hace falta utilizar el operador de resolución de alcance.
-             */
-            cout << "Soy un hatckback " << Sedan::marca << " " << Coupe::modelo << " de motor " << this->motor << endl;
-        }
-};
+using namespace std;
 
 int main() {
 
@@ -152,6 +46,49 @@ int main() {
     cout << endl;
 
     cout << "Autos creados: " << Auto::contador << endl;
+    cout << "Instancias de Auto: " << Auto::instancias << endl;
+    cout << "Instancias de Sedan: " << Sedan::instancias << endl;
+    cout << "Instancias de Coupe: " << Coupe::instancias << endl;
+    cout << "Instancias de Hatchback: " << Hatchback::instancias << endl;
+
+    cout << endl;
+
+    /**
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     * --------------------------------- Contenedor por tipo (Flota) ----------------------------------
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     *
+     * En lugar de crear cada auto con new, Flota los guarda en un vector contiguo
+     * por cada tipo concreto y los recorre un tipo a la vez.
+     */
+    Flota flota;
+    flota.agregar<Sedan>("Honda", "Civic", "Azul");
+    flota.agregar<Coupe>("Ford", "Mustang", "5.0 lt");
+    flota.agregar<Hatchback>("Volkswagen", "Golf", "Blanco", "1.4 lt");
+    flota.paraCada<Sedan>([](Sedan &s) { s.derrapar(); });
+    flota.encenderTodos();
+    cout << "Autos encendidos en la flota: " << flota.contarEncendidos() << " de " << flota.size() << endl;
+
+    cout << endl;
+
+    /**
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     * ------------------------------ Mapa de ranuras (manejadores) -----------------------------------
+     * ////////////////////////////////////////////////////////////////////////////////////////////////
+     *
+     * Cuando los autos entran y salen todo el tiempo, en lugar de un puntero se
+     * guarda un Manejador: sigue siendo válido aunque otros autos se eliminen, y
+     * detecta si el auto al que apuntaba ya no existe.
+     */
+    MapaRanuras<Sedan> estacionamiento;
+    Manejador civic = estacionamiento.insertar("Honda", "Civic", "Azul");
+    Manejador sentra = estacionamiento.insertar("Nissan", "Sentra", "Negro");
+    estacionamiento.eliminar(civic);
+    Manejador versa = estacionamiento.insertar("Nissan", "Versa", "Blanco");
+    estacionamiento[sentra].derrapar();
+    cout << "¿El Civic sigue en el estacionamiento? " << (estacionamiento.obtener(civic) ? "sí" : "no") << endl;
+    cout << "Ranura del Versa: " << versa.indice << " (la del Civic, generación " << versa.generacion << ")" << endl;
+    for (Sedan &s : estacionamiento) cout << "En el estacionamiento: " << s.marca << " " << s.modelo << endl;
 
     /**
      * ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,5 +120,12 @@ int main() {
      * reutilizable. A eso se le conoce como polimorfismo.
      */
 
+    // Todo lo que se crea con new se libera con delete (con su tipo concreto: Auto no tiene destructor virtual)
+    delete auto1;
+    delete auto2;
+    delete auto3;
+    delete auto4;
+    delete auto5;
+
     return 0;
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include <iostream>
 #include <cmath>
+/**
+ * Potencias con exponente entero sin pasar por pow().
+ */
+#include "../functions/potencia.h"
 
 using namespace std;
 
@@ -41,7 +45,7 @@ int main() {
             float radio, volumen;
             cout << "Ingrese radio (cm): ";
             cin >> radio;
-            volumen = (4 / 3) * PI * pow(radio, 3);
+            volumen = (4.0 / 3) * PI * potencia<3>(radio);
             cout << "Área del triángulo: " << volumen << "cm³" << endl;
         break;
         case 3:
@@ -87,7 +91,7 @@ int main() {
             cin >> x2;
             cout << "Ingrese valor de Y del P2: ";
             cin >> y2;
-            distancia = sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+            distancia = sqrt(potencia<2>(x2 - x1) + potencia<2>(y2 - y1));
             cout << endl << "Distancia entre P1 y P2: " << distancia << endl;
         break;
     }
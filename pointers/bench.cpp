@@ -0,0 +1,153 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include "buffer_alineado.h"
+#include "vistas.h"
+
+using namespace std;
+
+// El mejor de varios intentos: descarta las interrupciones de otros procesos
+template <typename Funcion>
+double medirMs(Funcion f, int repeticiones) {
+    double mejor = 1e300;
+    for (int r = 0; r < repeticiones; r++) {
+        auto inicio = chrono::steady_clock::now();
+        f();
+        mejor = min(mejor, chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count());
+    }
+    return mejor;
+}
+
+/**
+ * Cada caso se escribe dos veces: con aritmética de punteros a mano y con
+ * vistas. Si las vistas no agregan costo, los tiempos deben ser iguales.
+ */
+void benchVistas() {
+    const size_t N = 4096, BLOQUE = 1024, M = 384;
+    const int REPETICIONES = 10;
+
+    vector<int> datos(N * N);
+    for (size_t i = 0; i < datos.size(); i++) datos[i] = int(i * 2654435761u >> 20) - 2048;
+    Vista<int, ExtensionesDinamicas<2>> matriz(datos.data(), N, N);
+
+    cout << "Caso\t\t\t\t\tPunteros (ms)\tVistas (ms)" << endl;
+    auto reportar = [](const char *caso, double punteros, double vistas, bool iguales) {
+        cout << caso << "\t" << punteros << "\t\t" << vistas << (iguales ? "" : "  (!)") << endl;
+    };
+
+    long long s1 = 0, s2 = 0;
+    double p = medirMs([&]() {
+        s1 = 0;
+        for (size_t i = 0; i < N; i++) for (size_t j = 0; j < N; j++) s1 += *(datos.data() + i * N + j);
+    }, REPETICIONES);
+    double v = medirMs([&]() { s2 = sumar(matriz); }, REPETICIONES);
+    reportar("Suma 4096x4096 por filas\t", p, v, s1 == s2);
+
+    // Transpuesta: la vista por columnas se recorre en el orden de la memoria
+    p = medirMs([&]() {
+        s1 = 0;
+        for (size_t j = 0; j < N; j++) for (size_t i = 0; i < N; i++) s1 += *(datos.data() + i * N + j);
+    }, REPETICIONES);
+    auto transpuesta = transponer(matriz);
+    v = medirMs([&]() {
+        s2 = 0;
+        for (size_t i = 0; i < N; i++) for (size_t j = 0; j < N; j++) s2 += transpuesta(i, j);
+    }, REPETICIONES);
+    reportar("Transpuesta, índice por índice\t", p, v, s1 == s2);
+
+    p = medirMs([&]() {
+        s1 = 0;
+        for (size_t i = 0; i < BLOQUE; i++) {
+            const int *filaBloque = datos.data() + (i + 512) * N + 1024;
+            for (size_t j = 0; j < BLOQUE; j++) s1 += filaBloque[j];
+        }
+    }, REPETICIONES * 10);
+    auto bloque = recortar(matriz, { 512, 1024 }, { BLOQUE, BLOQUE });
+    v = medirMs([&]() { s2 = sumar(bloque); }, REPETICIONES * 10);
+    reportar("Suma de un bloque de 1024x1024\t", p, v, s1 == s2);
+
+    p = medirMs([&]() {
+        s1 = 0;
+        for (size_t i = 0; i < N; i++) s1 += *(datos.data() + i * N + 7);
+    }, REPETICIONES * 100);
+    v = medirMs([&]() { s2 = sumar(columna(matriz, 7)); }, REPETICIONES * 100);
+    reportar("Suma de una columna\t\t", p, v, s1 == s2);
+
+    /**
+     * Producto de matrices: arreglos planos, vistas dinámicas y vistas con extensiones estáticas.
+     * Con -O2, GCC solo vectoriza el ciclo interno si conoce cuántas vueltas da: las extensiones
+     * estáticas se lo dicen, las dinámicas no.
+     */
+    vector<double> a(M * M), b(M * M), c1(M * M), c2(M * M), c3(M * M);
+    for (size_t i = 0; i < M * M; i++) {
+        a[i] = double(i % 17) / 4;
+        b[i] = double(i % 13) / 8;
+    }
+    p = medirMs([&]() {
+        for (size_t i = 0; i < M; i++) {
+            double *ci = c1.data() + i * M;
+            for (size_t j = 0; j < M; j++) ci[j] = 0;
+            for (size_t k = 0; k < M; k++) {
+                double aik = a[i * M + k];
+                const double *bk = b.data() + k * M;
+                for (size_t j = 0; j < M; j++) ci[j] += aik * bk[j];
+            }
+        }
+    }, 5);
+    Vista<double, ExtensionesDinamicas<2>> va(a.data(), M, M), vb(b.data(), M, M), vc(c2.data(), M, M);
+    v = medirMs([&]() { multiplicar(va, vb, vc); }, 5);
+    reportar("Producto 384x384 (dinámicas)\t", p, v, c1 == c2);
+    Vista<double, Extensiones<M, M>> ea(a.data()), eb(b.data()), ec(c3.data());
+    v = medirMs([&]() { multiplicar(ea, eb, ec); }, 5);
+    reportar("Producto 384x384 (estáticas)\t", p, v, c1 == c3);
+}
+
+/**
+ * Mismo recorrido sobre buffers con páginas de 4 KiB y con páginas grandes.
+ * La primera escritura paga una falla de página por cada página nueva; el
+ * triad (c = a + k * b) es el kernel de streaming clásico, limitado por el
+ * ancho de banda; los accesos aleatorios fallan en el TLB en casi cada lectura
+ * cuando las páginas son chicas.
+ */
+void benchPaginas() {
+    const size_t N = 32 * 1024 * 1024; // 256 MiB por arreglo
+    const size_t ACCESOS = 10 * 1000 * 1000;
+
+    cout << "Respaldo				En páginas grandes	Primera escritura (ms)	Triad (ms)	Aleatorios (ms)" << endl;
+    for (PaginasGrandes paginas : { PaginasGrandes::NUNCA, PaginasGrandes::AUTOMATICO }) {
+        BufferAlineado<double> a(N, paginas), b(N, paginas), c(N, paginas);
+        double primera = medirMs([&]() {
+            for (size_t i = 0; i < N; i++) {
+                a[i] = double(i & 1023);
+                b[i] = double(i % 7);
+                c[i] = 0;
+            }
+        }, 1);
+        double triad = medirMs([&]() {
+            double *__restrict pc = c.data();
+            const double *pa = a.data(), *pb = b.data();
+            for (size_t i = 0; i < N; i++) pc[i] = pa[i] + 3.0 * pb[i];
+        }, 5);
+        double suma = 0;
+        double aleatorios = medirMs([&]() {
+            uint64_t x = 88172645463325252ull;
+            for (size_t k = 0; k < ACCESOS; k++) {
+                x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+                suma += c[x % N];
+            }
+        }, 3);
+        size_t grandes = a.bytesEnPaginasGrandes() + b.bytesEnPaginasGrandes() + c.bytesEnPaginasGrandes();
+        cout << nombreRespaldo(a.respaldo()) << (paginas == PaginasGrandes::NUNCA ? "\t\t\t" : "\t")
+             << grandes * 100 / (a.bytes() + b.bytes() + c.bytes()) << "%\t\t\t" << primera << "\t\t\t" << triad
+             << "\t\t" << aleatorios << (suma > 0 ? "" : "  (!)") << endl;
+    }
+}
+
+int main() {
+
+    benchVistas();
+    cout << endl;
+    benchPaginas();
+
+    return 0;
+}
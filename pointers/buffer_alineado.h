@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <type_traits>
+#include <unistd.h>
+
+using namespace std;
+
+/**
+ * Buffers alineados para arreglos numéricos grandes.
+ *
+ * Un arreglo en la pila o con 'new' solo garantiza la alineación de su tipo
+ * (4 bytes para un int), así que una carga SIMD de 16, 32 o 64 bytes puede
+ * cruzar dos líneas de caché. Además, cada página de 4 KiB ocupa una entrada
+ * del TLB (la caché de traducciones de direcciones): recorrer 1 GiB son
+ * 262144 páginas y otras tantas fallas de página al escribirlo por primera
+ * vez. Con páginas grandes de 2 MiB son 512.
+ *
+ * BufferAlineado<T> pide la memoria según el tamaño y reporta qué respaldo
+ * obtuvo:
+ *
+ *   - HEAP_ALINEADO: aligned_alloc a 64 bytes (una línea de caché), para
+ *     buffers de menos de 1 MiB.
+ *   - HUGETLB: mmap con MAP_HUGETLB. Solo funciona si el administrador
+ *     reservó páginas grandes (/proc/sys/vm/nr_hugepages).
+ *   - PAGINAS_GRANDES_TRANSPARENTES: mmap alineado a 2 MiB más
+ *     madvise(MADV_HUGEPAGE); el kernel usa páginas grandes cuando puede.
+ *     Solo si /sys/kernel/mm/transparent_hugepage/enabled no está en
+ *     "never": con ese modo madvise() no falla, pero nunca habrá páginas
+ *     grandes. Aun así el kernel puede no tener páginas libres; cuántos
+ *     bytes quedaron en páginas grandes lo dice bytesEnPaginasGrandes().
+ *   - PAGINAS_4K: mmap normal, alineado a página, si lo demás falla, si el
+ *     buffer mide menos de una página grande o si no se quieren.
+ *
+ * La memoria siempre inicia en cero, como la de mmap.
+ */
+#ifndef BUFFER_ALINEADO_H
+#define BUFFER_ALINEADO_H
+
+enum class Respaldo { HEAP_ALINEADO, PAGINAS_4K, PAGINAS_GRANDES_TRANSPARENTES, HUGETLB };
+
+inline const char *nombreRespaldo(Respaldo respaldo) {
+    switch (respaldo) {
+        case Respaldo::HEAP_ALINEADO: return "heap alineado a 64 bytes";
+        case Respaldo::PAGINAS_4K: return "páginas de 4 KiB";
+        case Respaldo::PAGINAS_GRANDES_TRANSPARENTES: return "páginas grandes transparentes (THP)";
+        case Respaldo::HUGETLB: return "páginas grandes reservadas (hugetlb)";
+    }
+    return "desconocido";
+}
+
+enum class PaginasGrandes { AUTOMATICO, NUNCA };
+
+constexpr size_t LINEA_CACHE = 64;
+// Tamaño de página grande en x86-64 y ARM64 con páginas base de 4 KiB
+constexpr size_t PAGINA_GRANDE = 2 * 1024 * 1024;
+
+template <typename T>
+class BufferAlineado {
+    static_assert(is_trivial<T>::value, "BufferAlineado es para tipos numéricos y estructuras simples");
+    public:
+        // Desde este tamaño conviene mmap; abajo, el heap
+        static constexpr size_t UMBRAL_MMAP = 1024 * 1024;
+
+        BufferAlineado() = default;
+        explicit BufferAlineado(size_t elementos, PaginasGrandes paginas = PaginasGrandes::AUTOMATICO) : elementos(elementos) {
+            if (elementos > SIZE_MAX / sizeof(T)) throw length_error("BufferAlineado demasiado grande");
+            size_t bytes = elementos * sizeof(T);
+            if (bytes < UMBRAL_MMAP) {
+                this->reservarHeap(bytes);
+                return;
+            }
+            // Con menos de una página grande, redondear a 2 MiB desperdiciaría memoria
+            bool grandes = paginas == PaginasGrandes::AUTOMATICO && bytes >= PAGINA_GRANDE;
+            if (!grandes || !(this->reservarHugetlb(bytes) || this->reservarTransparentes(bytes))) {
+                this->reservarPaginas(bytes, paginas);
+            }
+        }
+        ~BufferAlineado() {
+            this->liberar();
+        }
+        BufferAlineado(const BufferAlineado &) = delete;
+        BufferAlineado &operator=(const BufferAlineado &) = delete;
+        BufferAlineado(BufferAlineado &&otro) noexcept {
+            *this = move(otro);
+        }
+        BufferAlineado &operator=(BufferAlineado &&otro) noexcept {
+            if (this != &otro) {
+                this->liberar();
+                this->datos = otro.datos;
+                this->elementos = otro.elementos;
+                this->reservados = otro.reservados;
+                this->tipo = otro.tipo;
+                otro.datos = nullptr;
+                otro.elementos = otro.reservados = 0;
+            }
+            return *this;
+        }
+
+        T &operator[](size_t i) { return this->datos[i]; }
+        const T &operator[](size_t i) const { return this->datos[i]; }
+        T *data() { return this->datos; }
+        const T *data() const { return this->datos; }
+        T *begin() { return this->datos; }
+        T *end() { return this->datos + this->elementos; }
+        const T *begin() const { return this->datos; }
+        const T *end() const { return this->datos + this->elementos; }
+        size_t size() const { return this->elementos; }
+
+        Respaldo respaldo() const { return this->tipo; }
+        // Bytes pedidos al sistema (redondeados a línea de caché o página)
+        size_t bytes() const { return this->reservados; }
+        // Mayor potencia de 2 que divide la dirección, hasta una página grande
+        size_t alineacion() const {
+            uintptr_t d = reinterpret_cast<uintptr_t>(this->datos);
+            return d == 0 ? 0 : min(size_t(d & -d), PAGINA_GRANDE);
+        }
+
+        /**
+         * MADV_HUGEPAGE es solo un consejo: el kernel puede no tener páginas
+         * grandes libres. Esto cuenta, en /proc/self/smaps, cuántos bytes del
+         * buffer quedaron realmente en páginas grandes (las páginas se asignan
+         * al escribirlas por primera vez, así que se consulta después).
+         */
+        size_t bytesEnPaginasGrandes() const {
+            if (this->tipo == Respaldo::HUGETLB) return this->reservados;
+            if (this->tipo != Respaldo::PAGINAS_GRANDES_TRANSPARENTES) return 0;
+            FILE *smaps = fopen("/proc/self/smaps", "r");
+            if (smaps == nullptr) return 0;
+            uintptr_t inicio = reinterpret_cast<uintptr_t>(this->datos), fin = inicio + this->reservados;
+            size_t total = 0;
+            bool dentro = false;
+            char linea[512];
+            while (fgets(linea, sizeof(linea), smaps) != nullptr) {
+                unsigned long desde, hasta, kb;
+                // Encabezado de cada región: "desde-hasta permisos ..."
+                if (sscanf(linea, "%lx-%lx ", &desde, &hasta) == 2) {
+                    dentro = desde < fin && inicio < hasta;
+                } else if (dentro && sscanf(linea, "AnonHugePages: %lu kB", &kb) == 1) {
+                    total += kb * 1024;
+                }
+            }
+            fclose(smaps);
+            return min(total, this->reservados);
+        }
+    private:
+        T *datos = nullptr;
+        size_t elementos = 0;
+        size_t reservados = 0;
+        Respaldo tipo = Respaldo::HEAP_ALINEADO;
+
+        static size_t redondear(size_t bytes, size_t multiplo) {
+            return (bytes + multiplo - 1) / multiplo * multiplo;
+        }
+
+        void reservarHeap(size_t bytes) {
+            // aligned_alloc exige un tamaño múltiplo de la alineación
+            this->reservados = redondear(max(bytes, size_t(1)), LINEA_CACHE);
+            void *memoria = aligned_alloc(LINEA_CACHE, this->reservados);
+            if (memoria == nullptr) throw bad_alloc();
+            memset(memoria, 0, this->reservados);
+            this->datos = static_cast<T *>(memoria);
+            this->tipo = Respaldo::HEAP_ALINEADO;
+        }
+        bool reservarHugetlb(size_t bytes) {
+            size_t total = redondear(bytes, PAGINA_GRANDE);
+            void *memoria = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (memoria == MAP_FAILED) return false;
+            this->adoptar(memoria, total, Respaldo::HUGETLB);
+            return true;
+        }
+        bool reservarTransparentes(size_t bytes) {
+            if (!transparentesHabilitadas()) return false;
+            /**
+             * mmap solo alinea a 4 KiB. Se pide una página grande de más, se
+             * recorta el inicio hasta la siguiente frontera de 2 MiB y se
+             * devuelve el sobrante, para que el kernel pueda usar páginas grandes
+             * desde el primer byte.
+             */
+            size_t total = redondear(bytes, PAGINA_GRANDE);
+            void *memoria = mmap(nullptr, total + PAGINA_GRANDE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memoria == MAP_FAILED) return false;
+            uintptr_t base = reinterpret_cast<uintptr_t>(memoria), alineada = redondear(base, PAGINA_GRANDE);
+            if (alineada > base) munmap(memoria, alineada - base);
+            munmap(reinterpret_cast<void *>(alineada + total), base + PAGINA_GRANDE - alineada);
+            if (madvise(reinterpret_cast<void *>(alineada), total, MADV_HUGEPAGE) != 0) {
+                // Kernel compilado sin THP
+                munmap(reinterpret_cast<void *>(alineada), total);
+                return false;
+            }
+            this->adoptar(reinterpret_cast<void *>(alineada), total, Respaldo::PAGINAS_GRANDES_TRANSPARENTES);
+            return true;
+        }
+        void reservarPaginas(size_t bytes, PaginasGrandes paginas) {
+            size_t total = redondear(bytes, size_t(sysconf(_SC_PAGESIZE)));
+            void *memoria = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memoria == MAP_FAILED) throw bad_alloc();
+            // Con THP en modo "always" el kernel usaría páginas grandes aunque no se pidan
+            if (paginas == PaginasGrandes::NUNCA) madvise(memoria, total, MADV_NOHUGEPAGE);
+            this->adoptar(memoria, total, Respaldo::PAGINAS_4K);
+        }
+        /**
+         * El modo activo es el que está entre corchetes, p. ej.
+         * "always [madvise] never". Se lee una sola vez por programa.
+         */
+        static bool transparentesHabilitadas() {
+            static const bool habilitadas = []() {
+                FILE *archivo = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+                if (archivo == nullptr) return false;
+                char modo[64] = {};
+                bool leido = fgets(modo, sizeof(modo), archivo) != nullptr;
+                fclose(archivo);
+                return leido && strstr(modo, "[never]") == nullptr;
+            }();
+            return habilitadas;
+        }
+        void adoptar(void *memoria, size_t total, Respaldo respaldo) {
+            this->datos = static_cast<T *>(memoria);
+            this->reservados = total;
+            this->tipo = respaldo;
+        }
+        void liberar() {
+            if (this->datos == nullptr) return;
+            if (this->tipo == Respaldo::HEAP_ALINEADO) free(this->datos);
+            else munmap(this->datos, this->reservados);
+            this->datos = nullptr;
+        }
+};
+
+#endif
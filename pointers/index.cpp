@@ -1,4 +1,12 @@
 #include <iostream>
+/**
+ * Vistas multidimensionales: la aritmética de punteros de abajo, empaquetada.
+ */
+#include "vistas.h"
+/**
+ * Buffers alineados a línea de caché o a página grande.
+ */
+#include "buffer_alineado.h"
 
 using namespace std;
 
@@ -91,6 +99,37 @@ int main() {
     cout << "Contenido de index 0: " << *(arreglo + 0) << endl;
     cout << "Contenido de index 3: " << *(arreglo + 3) << endl;
 
+    cout << endl;
+
+    /**
+     * Una vista hace esa misma aritmética para varias dimensiones. El arreglo de
+     * 4 elementos visto como matriz de 2x2 guarda (i, j) en *(arreglo + i * 2 + j);
+     * su transpuesta es otra vista sobre los mismos 16 bytes, sin copiar nada.
+     */
+    Vista<int, Extensiones<2, 2>> matriz(arreglo);
+    auto transpuesta = transponer(matriz);
+    cout << "Matriz (1, 0): " << matriz(1, 0) << ", transpuesta (0, 1): " << transpuesta(0, 1) << endl;
+    cout << "Dir. de matriz (1, 0): " << &matriz(1, 0) << " = arreglo + 2: " << arreglo + 2 << endl;
+    transpuesta(0, 1) = 7;
+    cout << "Después de escribir en la transpuesta, index 2: " << arreglo[2] << endl;
+    cout << "Suma de la columna 1: " << sumar(columna(matriz, 1)) << ", menor valor: " << minimo(matriz) << endl;
+
+    cout << endl;
+
+    /**
+     * Un arreglo en la pila solo se alinea al tamaño de su tipo. Para arreglos
+     * grandes conviene pedir memoria alineada y, si el sistema lo permite, en
+     * páginas de 2 MiB: menos fallas de página y menos entradas del TLB.
+     */
+    BufferAlineado<int> pequenio(1000), grande(1024 * 1024);
+    cout << "Dir. de arreglo: " << arreglo << ", alineado a " << alignof(int) << " bytes" << endl;
+    cout << "Buffer de 1000 enteros: " << nombreRespaldo(pequenio.respaldo()) << ", dir. " << pequenio.data() << endl;
+    cout << "Buffer de 4 MiB: " << nombreRespaldo(grande.respaldo()) << ", alineado a " << grande.alineacion() << " bytes" << endl;
+    Vista<int, ExtensionesDinamicas<2>> tabla(grande.data(), 1024, 1024);
+    tabla(1023, 1023) = 1;
+    cout << "Suma de la tabla de 1024x1024: " << sumar(tabla) << endl;
+    cout << "Bytes en páginas grandes: " << grande.bytesEnPaginasGrandes() << endl;
+
     return 0;
 }
 
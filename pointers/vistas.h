@@ -0,0 +1,376 @@
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+/**
+ * Vistas multidimensionales sin copia (al estilo de std::mdspan de C++23).
+ *
+ * Con aritmética de punteros, el elemento (i, j) de una matriz de F filas y C
+ * columnas guardada fila por fila está en *(datos + i * C + j). Una vista
+ * guarda solo el puntero y la regla para convertir índices en ese
+ * desplazamiento, sin ser dueña de los datos:
+ *
+ *   extensiones   tamaño de cada dimensión (conocido al compilar o no)
+ *   disposición   cómo se acomodan en memoria: por filas, por columnas o con
+ *                 un paso arbitrario por dimensión
+ *
+ * Recortar un bloque, tomar una fila o columna, transponer o reinterpretar un
+ * arreglo con otra forma solo crea otra vista sobre los mismos datos.
+ */
+#ifndef VISTAS_H
+#define VISTAS_H
+
+// Extensión que se conoce hasta la ejecución
+constexpr size_t DINAMICA = numeric_limits<size_t>::max();
+
+// Posición de cada dimensión dinámica entre las dinámicas (las estáticas no se guardan)
+template <size_t N>
+constexpr array<size_t, N> posicionesDinamicas(const array<size_t, N> &estaticas) {
+    array<size_t, N> posiciones = {};
+    size_t dinamicas = 0;
+    for (size_t r = 0; r < N; r++) posiciones[r] = estaticas[r] == DINAMICA ? dinamicas++ : DINAMICA;
+    return posiciones;
+}
+
+template <size_t... E>
+class Extensiones {
+    public:
+        static constexpr size_t RANGO = sizeof...(E);
+        static constexpr array<size_t, RANGO> ESTATICAS = { E... };
+        static constexpr size_t DINAMICAS = (size_t(E == DINAMICA) + ... + 0);
+
+        // Solo si todas las extensiones son estáticas; si no, el error es de compilación
+        constexpr Extensiones() : valores{} {
+            static_assert(DINAMICAS == 0, "Falta el tamaño de una dimensión dinámica");
+        }
+        // El tamaño de cada dimensión; las estáticas deben coincidir
+        template <typename... Tamanios, typename = enable_if_t<sizeof...(Tamanios) == RANGO && (is_integral<Tamanios>::value && ...)>>
+        constexpr Extensiones(Tamanios... tamanios) : Extensiones(array<size_t, RANGO>{ size_t(tamanios)... }) {}
+        constexpr Extensiones(const array<size_t, RANGO> &tamanios) : valores{} {
+            for (size_t r = 0; r < RANGO; r++) {
+                if (ESTATICAS[r] == DINAMICA) this->valores[POSICIONES[r]] = tamanios[r];
+                else if (ESTATICAS[r] != tamanios[r]) throw invalid_argument("El tamaño no coincide con la extensión estática");
+            }
+        }
+
+        // Una extensión estática es una constante para el compilador
+        constexpr size_t extension(size_t r) const {
+            return ESTATICAS[r] != DINAMICA ? ESTATICAS[r] : this->valores[POSICIONES[r]];
+        }
+        constexpr size_t size() const {
+            size_t total = 1;
+            for (size_t r = 0; r < RANGO; r++) total *= this->extension(r);
+            return total;
+        }
+    private:
+        static constexpr array<size_t, RANGO> POSICIONES = posicionesDinamicas<RANGO>(ESTATICAS);
+
+        array<size_t, DINAMICAS> valores;
+};
+
+// Extensiones<DINAMICA, ..., DINAMICA> con N dimensiones
+template <size_t N, typename = make_index_sequence<N>>
+struct GeneradorDinamicas;
+template <size_t>
+struct SiempreDinamica {
+    static constexpr size_t valor = DINAMICA;
+};
+template <size_t N, size_t... I>
+struct GeneradorDinamicas<N, index_sequence<I...>> {
+    typedef Extensiones<SiempreDinamica<I>::valor...> tipo;
+};
+template <size_t N>
+using ExtensionesDinamicas = typename GeneradorDinamicas<N>::tipo;
+
+/**
+ * Disposición por filas (row-major, la de los arreglos de C): el último índice
+ * es el contiguo. desplazamiento = ((i0 * E1 + i1) * E2 + i2) ...
+ */
+struct DisposicionFilas {
+    template <typename Ext>
+    class Mapeo {
+        public:
+            static constexpr size_t RANGO = Ext::RANGO;
+
+            constexpr Mapeo(const Ext &extensiones) : ext(extensiones) {}
+            constexpr const Ext &extensiones() const { return this->ext; }
+            constexpr size_t operator()(const array<size_t, RANGO> &i) const {
+                size_t d = 0;
+                for (size_t r = 0; r < RANGO; r++) d = d * this->ext.extension(r) + i[r];
+                return d;
+            }
+            constexpr size_t paso(size_t r) const {
+                size_t p = 1;
+                for (size_t s = r + 1; s < RANGO; s++) p *= this->ext.extension(s);
+                return p;
+            }
+            // El índice más rápido al recorrer: el último
+            constexpr bool ordenInverso() const { return false; }
+            static constexpr bool CONTIGUA = true;
+        private:
+            Ext ext;
+    };
+};
+
+/**
+ * Disposición por columnas (column-major, la de Fortran y MATLAB): el primer
+ * índice es el contiguo. Una matriz por filas vista por columnas es su
+ * transpuesta.
+ */
+struct DisposicionColumnas {
+    template <typename Ext>
+    class Mapeo {
+        public:
+            static constexpr size_t RANGO = Ext::RANGO;
+
+            constexpr Mapeo(const Ext &extensiones) : ext(extensiones) {}
+            constexpr const Ext &extensiones() const { return this->ext; }
+            constexpr size_t operator()(const array<size_t, RANGO> &i) const {
+                size_t d = 0;
+                for (size_t r = RANGO; r-- > 0;) d = d * this->ext.extension(r) + i[r];
+                return d;
+            }
+            constexpr size_t paso(size_t r) const {
+                size_t p = 1;
+                for (size_t s = 0; s < r; s++) p *= this->ext.extension(s);
+                return p;
+            }
+            constexpr bool ordenInverso() const { return true; }
+            static constexpr bool CONTIGUA = true;
+        private:
+            Ext ext;
+    };
+};
+
+/**
+ * Disposición con un paso (stride) arbitrario por dimensión, en elementos:
+ * desplazamiento = i0 * P0 + i1 * P1 + ... Cubre recortes, filas o columnas
+ * sueltas y cualquier transposición.
+ */
+struct DisposicionPasos {
+    template <typename Ext>
+    class Mapeo {
+        public:
+            static constexpr size_t RANGO = Ext::RANGO;
+
+            constexpr Mapeo(const Ext &extensiones, const array<size_t, RANGO> &pasos) : ext(extensiones), pasos(pasos) {}
+            constexpr const Ext &extensiones() const { return this->ext; }
+            constexpr size_t operator()(const array<size_t, RANGO> &i) const {
+                size_t d = 0;
+                for (size_t r = 0; r < RANGO; r++) d += i[r] * this->pasos[r];
+                return d;
+            }
+            constexpr size_t paso(size_t r) const { return this->pasos[r]; }
+            // Se recorre primero la dimensión de paso más corto
+            constexpr bool ordenInverso() const { return RANGO > 1 && this->pasos[0] < this->pasos[RANGO - 1]; }
+            static constexpr bool CONTIGUA = false;
+        private:
+            Ext ext;
+            array<size_t, RANGO> pasos;
+    };
+};
+
+template <typename T, typename Ext, typename Disposicion = DisposicionFilas>
+class Vista {
+    public:
+        typedef T tipo_elemento;
+        typedef Ext tipo_extensiones;
+        typedef Disposicion tipo_disposicion;
+        typedef typename Disposicion::template Mapeo<Ext> Mapeo;
+        static constexpr size_t RANGO = Ext::RANGO;
+
+        constexpr Vista(T *datos, const Mapeo &mapeo) : datos(datos), mapa(mapeo) {}
+        constexpr Vista(T *datos, const Ext &extensiones) : datos(datos), mapa(extensiones) {}
+        // Con todas las extensiones estáticas basta el puntero: Vista<int, Extensiones<3, 3>>(p)
+        constexpr explicit Vista(T *datos) : Vista(datos, Ext()) {}
+        // Vista por filas o columnas indicando solo los tamaños: Vista<int, ExtensionesDinamicas<2>>(p, 3, 4)
+        template <typename... Tamanios, typename = enable_if_t<sizeof...(Tamanios) == RANGO && (is_integral<Tamanios>::value && ...)>>
+        constexpr Vista(T *datos, Tamanios... tamanios) : Vista(datos, Ext(tamanios...)) {}
+
+        template <typename... Indices>
+        constexpr T &operator()(Indices... indices) const {
+            static_assert(sizeof...(Indices) == RANGO, "Se necesita un índice por dimensión");
+            return this->datos[this->mapa({ size_t(indices)... })];
+        }
+        constexpr T &en(const array<size_t, RANGO> &indices) const {
+            return this->datos[this->mapa(indices)];
+        }
+
+        constexpr size_t extension(size_t r) const { return this->mapa.extensiones().extension(r); }
+        constexpr size_t paso(size_t r) const { return this->mapa.paso(r); }
+        constexpr size_t size() const { return this->mapa.extensiones().size(); }
+        constexpr T *data() const { return this->datos; }
+        constexpr const Mapeo &mapeo() const { return this->mapa; }
+    private:
+        T *datos;
+        Mapeo mapa;
+};
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * -------------------------------- Vistas derivadas (sin copia) ----------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ */
+
+// Todos los pasos de una vista, para construir vistas con DisposicionPasos
+template <typename V>
+constexpr array<size_t, V::RANGO> pasosDe(const V &v) {
+    array<size_t, V::RANGO> pasos = {};
+    for (size_t r = 0; r < V::RANGO; r++) pasos[r] = v.paso(r);
+    return pasos;
+}
+
+/**
+ * Bloque de 'tamanio' elementos por dimensión a partir de 'inicio'. El
+ * resultado comparte los datos: escribir en el bloque escribe en el original.
+ */
+template <typename V>
+Vista<typename V::tipo_elemento, ExtensionesDinamicas<V::RANGO>, DisposicionPasos>
+recortar(const V &v, const array<size_t, V::RANGO> &inicio, const array<size_t, V::RANGO> &tamanio) {
+    for (size_t r = 0; r < V::RANGO; r++) {
+        if (inicio[r] + tamanio[r] > v.extension(r)) throw out_of_range("El recorte sale de la vista");
+    }
+    typedef ExtensionesDinamicas<V::RANGO> Ext;
+    typename DisposicionPasos::template Mapeo<Ext> mapeo(Ext(tamanio), pasosDe(v));
+    return { v.data() + v.mapeo()(inicio), mapeo };
+}
+
+// Fila i y columna j de una matriz, como vistas de una dimensión
+template <typename V>
+Vista<typename V::tipo_elemento, ExtensionesDinamicas<1>, DisposicionPasos> fila(const V &m, size_t i) {
+    static_assert(V::RANGO == 2, "fila() requiere una matriz");
+    if (i >= m.extension(0)) throw out_of_range("Fila fuera de la matriz");
+    typedef ExtensionesDinamicas<1> Ext;
+    return { &m(i, 0), typename DisposicionPasos::template Mapeo<Ext>(Ext(m.extension(1)), { m.paso(1) }) };
+}
+template <typename V>
+Vista<typename V::tipo_elemento, ExtensionesDinamicas<1>, DisposicionPasos> columna(const V &m, size_t j) {
+    static_assert(V::RANGO == 2, "columna() requiere una matriz");
+    if (j >= m.extension(1)) throw out_of_range("Columna fuera de la matriz");
+    typedef ExtensionesDinamicas<1> Ext;
+    return { &m(0, j), typename DisposicionPasos::template Mapeo<Ext>(Ext(m.extension(0)), { m.paso(0) }) };
+}
+
+/**
+ * Transpuesta de una matriz: se intercambian extensiones y pasos. Una vista
+ * por filas transpuesta es una vista por columnas (y al revés), así que la
+ * disposición sigue siendo contigua y las extensiones estáticas se conservan.
+ */
+template <typename T, size_t F, size_t C>
+Vista<T, Extensiones<C, F>, DisposicionColumnas> transponer(const Vista<T, Extensiones<F, C>, DisposicionFilas> &m) {
+    return { m.data(), Extensiones<C, F>(m.extension(1), m.extension(0)) };
+}
+template <typename T, size_t F, size_t C>
+Vista<T, Extensiones<C, F>, DisposicionFilas> transponer(const Vista<T, Extensiones<F, C>, DisposicionColumnas> &m) {
+    return { m.data(), Extensiones<C, F>(m.extension(1), m.extension(0)) };
+}
+template <typename T, size_t F, size_t C>
+Vista<T, Extensiones<C, F>, DisposicionPasos> transponer(const Vista<T, Extensiones<F, C>, DisposicionPasos> &m) {
+    typedef Extensiones<C, F> Ext;
+    return { m.data(), typename DisposicionPasos::template Mapeo<Ext>(Ext(m.extension(1), m.extension(0)), { m.paso(1), m.paso(0) }) };
+}
+
+/**
+ * Misma memoria con otra forma (p. ej. un arreglo de 12 como matriz de 3x4).
+ * Solo tiene sentido sobre datos contiguos.
+ */
+template <typename Ext, typename V>
+Vista<typename V::tipo_elemento, Ext, typename V::tipo_disposicion> reformar(const V &v, const Ext &extensiones) {
+    static_assert(V::Mapeo::CONTIGUA, "Solo se puede reformar una vista contigua");
+    if (extensiones.size() != v.size()) throw invalid_argument("La nueva forma debe tener la misma cantidad de elementos");
+    return { v.data(), extensiones };
+}
+
+/**
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ * --------------------------------------- Algoritmos ---------------------------------------------
+ * ////////////////////////////////////////////////////////////////////////////////////////////////
+ *
+ * Reciben cualquier vista. El recorrido sigue la memoria: la dimensión de paso
+ * más corto va en el ciclo más interno.
+ */
+template <size_t D, typename V, typename Funcion>
+constexpr void recorrerDesde(const V &v, array<size_t, V::RANGO> &i, bool inverso, Funcion &f) {
+    if constexpr (D == V::RANGO) {
+        f(v.en(i));
+    } else {
+        size_t r = inverso ? V::RANGO - 1 - D : D;
+        size_t n = v.extension(r);
+        for (i[r] = 0; i[r] < n; i[r]++) recorrerDesde<D + 1>(v, i, inverso, f);
+    }
+}
+template <typename V, typename Funcion>
+constexpr void paraCada(const V &v, Funcion f) {
+    array<size_t, V::RANGO> i = {};
+    recorrerDesde<0>(v, i, v.mapeo().ordenInverso(), f);
+}
+
+template <typename V>
+constexpr auto sumar(const V &v) {
+    typedef typename V::tipo_elemento T;
+    // Los enteros pequeños se acumulan en uno más grande para no desbordarse
+    typename conditional<is_integral<T>::value, long long, remove_cv_t<T>>::type total = 0;
+    paraCada(v, [&total](const T &x) { total += x; });
+    return total;
+}
+template <typename V>
+constexpr remove_cv_t<typename V::tipo_elemento> minimo(const V &v) {
+    typedef typename V::tipo_elemento T;
+    if (v.size() == 0) throw invalid_argument("La vista está vacía");
+    remove_cv_t<T> menor = v.data()[v.mapeo()({})];
+    paraCada(v, [&menor](const T &x) {
+        if (x < menor) menor = x;
+    });
+    return menor;
+}
+
+// destino += escalar * origen. restrict le asegura al compilador que las filas no se traslapan
+template <typename T>
+void sumarEscalado(T *__restrict destino, const T *__restrict origen, T escalar, size_t n) {
+    for (size_t j = 0; j < n; j++) destino[j] += escalar * origen[j];
+}
+
+// Fila i de C = A * B; con CONTIGUAS el ciclo interno es el de sumarEscalado()
+template <bool CONTIGUAS, typename VA, typename VB, typename VC>
+void multiplicarFila(const VA &a, const VB &b, const VC &c, size_t i) {
+    size_t comun = a.extension(1), columnas = b.extension(1), pasoB = b.paso(1), pasoC = c.paso(1);
+    auto *ci = &c(i, 0);
+    for (size_t j = 0; j < columnas; j++) ci[j * pasoC] = 0;
+    for (size_t k = 0; k < comun; k++) {
+        auto aik = a(i, k);
+        const auto *bk = &b(k, 0);
+        if (CONTIGUAS) {
+            sumarEscalado(ci, bk, aik, columnas);
+        } else {
+            for (size_t j = 0; j < columnas; j++) ci[j * pasoC] += aik * bk[j * pasoB];
+        }
+    }
+}
+
+/**
+ * Producto de matrices C = A * B con cualquier combinación de disposiciones.
+ * El orden i-k-j recorre B y C por filas en el ciclo interno. C no debe
+ * compartir memoria con A ni con B.
+ */
+template <typename VA, typename VB, typename VC>
+void multiplicar(const VA &a, const VB &b, const VC &c) {
+    static_assert(VA::RANGO == 2 && VB::RANGO == 2 && VC::RANGO == 2, "multiplicar() requiere matrices");
+    size_t filas = a.extension(0), comun = a.extension(1), columnas = b.extension(1);
+    if (b.extension(0) != comun || c.extension(0) != filas || c.extension(1) != columnas) {
+        throw invalid_argument("Dimensiones incompatibles para el producto");
+    }
+    // Con comun == 0 el producto es una matriz de ceros: multiplicarFila() la limpia
+    if (filas == 0 || columnas == 0) return;
+    bool contiguas = b.paso(1) == 1 && c.paso(1) == 1;
+    for (size_t i = 0; i < filas; i++) {
+        if (contiguas) multiplicarFila<true>(a, b, c, i);
+        else multiplicarFila<false>(a, b, c, i);
+    }
+}
+
+#endif
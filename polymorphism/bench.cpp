@@ -0,0 +1,168 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+#include "mamiferos.h"
+#include "estatico.h"
+#include "poblacion.h"
+
+using namespace std;
+
+/**
+ * Tres formas de llamar a alimentar() sobre una población mezclada:
+ *
+ * + virtual: vector<Mamifero*> con cada objeto creado con new (llamada por vtable).
+ * + variant: vector<estatico::Animal> por valor (visit según el índice del variant).
+ * + por tipo: estatico::Manada, todos los perros y luego todas las personas.
+ *
+ * Las poblaciones pequeñas caben en caché y miden el costo de la llamada; las
+ * grandes también miden los accesos a memoria. Con un orden aleatorio de tipos
+ * el predictor de saltos falla en virtual y variant, pero no en el recorrido
+ * por tipo.
+ */
+struct Mezcla {
+    const char *nombre;
+    double proporcionPerros;
+    bool aleatoria;
+};
+
+// true si el i-ésimo mamífero de la población es un perro
+vector<bool> generarTipos(size_t n, Mezcla mezcla) {
+    vector<bool> esPerro(n);
+    mt19937 generador(7);
+    uniform_real_distribution<double> distribucion(0.0, 1.0);
+    for (size_t i = 0; i < n; i++) {
+        if (mezcla.aleatoria) esPerro[i] = distribucion(generador) < mezcla.proporcionPerros;
+        // Patrón periódico: 1 de cada 2 si la proporción es 0.5
+        else esPerro[i] = mezcla.proporcionPerros >= 1.0 || i % 2 == 0;
+    }
+    return esPerro;
+}
+
+template <typename Recorrer>
+double nsPorLlamada(size_t n, size_t pasadas, Recorrer recorrer) {
+    auto inicio = chrono::steady_clock::now();
+    for (size_t p = 0; p < pasadas; p++) recorrer();
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count() / (double(n) * pasadas);
+}
+
+void medir(size_t n, Mezcla mezcla) {
+    const size_t LLAMADAS = 20000000;
+    size_t pasadas = LLAMADAS / n;
+    vector<bool> esPerro = generarTipos(n, mezcla);
+
+    vector<unique_ptr<Mamifero>> punteros;
+    vector<estatico::Animal> animales;
+    estatico::Manada manada;
+    animales.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        if (esPerro[i]) {
+            punteros.push_back(make_unique<Perro>("Mizu", 5));
+            animales.push_back(estatico::Perro("Mizu", 5));
+            manada.agregar<estatico::Perro>("Mizu", 5);
+        } else {
+            punteros.push_back(make_unique<Persona>("Software Engineer", 23));
+            animales.push_back(estatico::Persona("Software Engineer", 23));
+            manada.agregar<estatico::Persona>("Software Engineer", 23);
+        }
+    }
+
+    double virtualNs = nsPorLlamada(n, pasadas, [&]() {
+        for (unique_ptr<Mamifero> &m : punteros) m->alimentar(3);
+    });
+    double variantNs = nsPorLlamada(n, pasadas, [&]() {
+        for (estatico::Animal &a : animales) a.alimentar(3);
+    });
+    double porTipoNs = nsPorLlamada(n, pasadas, [&]() {
+        manada.alimentarTodos(3);
+    });
+
+    // Las tres poblaciones deben terminar con la misma energía
+    long long energiaVirtual = 0, energiaVariant = 0, energiaPorTipo = 0;
+    for (unique_ptr<Mamifero> &m : punteros) energiaVirtual += m->getEnergia();
+    for (estatico::Animal &a : animales) energiaVariant += a.getEnergia();
+    manada.paraTodos([&energiaPorTipo](auto &m) { energiaPorTipo += m.getEnergia(); });
+    bool iguales = energiaVirtual == energiaVariant && energiaVariant == energiaPorTipo;
+
+    cout << n << "\t" << mezcla.nombre << "\t" << virtualNs << "\t" << variantNs << "\t" << porTipoNs
+         << (iguales ? "" : "\t(!) energía distinta") << endl;
+}
+
+void benchLlamadas() {
+    Mezcla mezclas[] = {
+        { "solo perros   ", 1.0, false },
+        { "50/50 alterna ", 0.5, false },
+        { "90/10 aleatoria", 0.9, true },
+        { "50/50 aleatoria", 0.5, true }
+    };
+    size_t tamanios[] = { 1000, 100000, 1000000 };
+
+    cout << "ns por llamada a alimentar()" << endl;
+    cout << "N\tmezcla\t\tvirtual\tvariant\tpor tipo" << endl;
+    for (size_t n : tamanios) {
+        for (Mezcla mezcla : mezclas) medir(n, mezcla);
+    }
+}
+
+/**
+ * Construcción y destrucción de una población mezclada. Los textos tienen más
+ * de 15 caracteres para que no quepan en el buffer interno de string (SSO) y
+ * cada animal reserve también memoria para su texto.
+ */
+const char *NOMBRE_PERRO = "Mizu de la colonia Roma";
+const char *OFICIO_PERSONA = "Software Engineer Senior";
+
+void reportar(const char *nombre, size_t n, double segundosCrear, double segundosLiberar) {
+    cout << nombre << ": crear " << segundosCrear * 1e9 / n << " ns/animal, liberar "
+         << segundosLiberar * 1e9 / n << " ns/animal (" << segundosLiberar * 1e3 << " ms en total)" << endl;
+}
+
+void medirNewDelete(size_t n) {
+    auto inicio = chrono::steady_clock::now();
+    vector<unique_ptr<Mamifero>> poblacion;
+    poblacion.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        if (i % 2 == 0) poblacion.push_back(make_unique<Perro>(NOMBRE_PERRO, 5));
+        else poblacion.push_back(make_unique<Persona>(OFICIO_PERSONA, 23));
+    }
+    auto creada = chrono::steady_clock::now();
+    // Gracias al destructor virtual, cada delete libera también el string del hijo
+    poblacion = vector<unique_ptr<Mamifero>>();
+    auto fin = chrono::steady_clock::now();
+    reportar("new/delete y std::string        ", n, chrono::duration<double>(creada - inicio).count(),
+        chrono::duration<double>(fin - creada).count());
+}
+
+template <typename Recurso>
+void medirPoblacion(const char *nombre, size_t n) {
+    auto inicio = chrono::steady_clock::now();
+    recurso::PoblacionEn<Recurso> poblacion;
+    poblacion.reservar(n);
+    for (size_t i = 0; i < n; i++) {
+        if (i % 2 == 0) poblacion.template crear<recurso::Perro>(NOMBRE_PERRO, 5);
+        else poblacion.template crear<recurso::Persona>(OFICIO_PERSONA, 23);
+    }
+    auto creada = chrono::steady_clock::now();
+    poblacion.liberar();
+    auto fin = chrono::steady_clock::now();
+    reportar(nombre, n, chrono::duration<double>(creada - inicio).count(),
+        chrono::duration<double>(fin - creada).count());
+}
+
+void benchPoblacion() {
+    const size_t N = 10000000;
+    cout << N << " animales mezclados (mitad perros, mitad personas)" << endl;
+    medirNewDelete(N);
+    medirPoblacion<pmr::monotonic_buffer_resource>("pmr monotonic_buffer_resource   ", N);
+    medirPoblacion<pmr::unsynchronized_pool_resource>("pmr unsynchronized_pool_resource", N);
+}
+
+int main() {
+
+    benchLlamadas();
+    cout << endl;
+    benchPoblacion();
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Polimorfismo estático para un conjunto cerrado de mamíferos.
+ *
+ * Con 'virtual', cada llamada a comer() busca la función en la tabla virtual
+ * (vtable) del objeto, por lo que el compilador no puede expandirla en línea
+ * (inline), y los objetos suelen manejarse por puntero, cada uno en un lugar
+ * distinto del heap.
+ *
+ * Si los tipos posibles se conocen de antemano (Perro y Persona), el tipo de
+ * cada llamada puede resolverse al compilar:
+ *
+ * + CRTP (Curiously Recurring Template Pattern): la clase padre recibe al hijo
+ *   como parámetro de plantilla y lo invoca con static_cast, sin vtable.
+ * + Animal: un std::variant<Perro, Persona> guardado por valor; visit() elige
+ *   la función según un índice guardado junto al objeto.
+ * + Manada: un vector por tipo, para recorrer todos los perros y luego todas
+ *   las personas sin decidir el tipo en cada llamada.
+ *
+ * Las clases conservan la misma sintaxis de llamada (mizu.comer()), pero viven
+ * en el espacio de nombres 'estatico' para no chocar con las de mamiferos.h.
+ */
+#ifndef ESTATICO_H
+#define ESTATICO_H
+
+namespace estatico {
+
+    template <typename Derivado>
+    class Mamifero {
+        private:
+            int edad;
+        protected:
+            int energia = 0;
+        public:
+            Mamifero(int edad) {
+                this->edad = edad;
+            }
+            // Sin virtual: si el hijo define su propio comer(), este queda oculto
+            void comer() {
+                cout << "¡El mamífero está comiendo!" << endl;
+            }
+            /**
+             * El algoritmo vive en el padre y el hijo solo define cuánta energía
+             * aporta una ración. static_cast al hijo se resuelve al compilar.
+             */
+            void alimentar(int racion) {
+                this->energia += static_cast<Derivado *>(this)->energiaPorRacion(racion);
+            }
+            int getEnergia() const {
+                return this->energia;
+            }
+    };
+
+    class Perro : public Mamifero<Perro> {
+        private:
+            string nombre;
+        public:
+            Perro(string nombre, int edad) : Mamifero(edad) {
+                this->nombre = nombre;
+            }
+            void comer() {
+                cout << "Wof wof..." << endl;
+                Mamifero::comer();
+            }
+            int energiaPorRacion(int racion) const {
+                return 2 * racion;
+            }
+    };
+
+    class Persona : public Mamifero<Persona> {
+        private:
+            string oficio;
+        public:
+            Persona(string oficio, int edad) : Mamifero(edad) {
+                this->oficio = oficio;
+            }
+            void comer() {
+                Mamifero::comer();
+                cout << "Hey, soy humano y estoy comiendo..." << endl;
+            }
+            int energiaPorRacion(int racion) const {
+                return racion + 1;
+            }
+    };
+
+    /**
+     * Cualquier mamífero del conjunto cerrado, guardado por valor. Un
+     * vector<Animal> es un solo bloque contiguo de memoria.
+     */
+    class Animal {
+        public:
+            Animal(Perro perro) : valor(move(perro)) {}
+            Animal(Persona persona) : valor(move(persona)) {}
+
+            void comer() {
+                visit([](auto &m) { m.comer(); }, this->valor);
+            }
+            void alimentar(int racion) {
+                visit([racion](auto &m) { m.alimentar(racion); }, this->valor);
+            }
+            int getEnergia() const {
+                return visit([](const auto &m) { return m.getEnergia(); }, this->valor);
+            }
+        private:
+            variant<Perro, Persona> valor;
+    };
+
+    /**
+     * Mamíferos agrupados por tipo: cada llamada dentro de un grupo es directa
+     * y el compilador puede vectorizar el recorrido.
+     */
+    class Manada {
+        public:
+            template <typename T, typename... Args>
+            T &agregar(Args &&... args) {
+                return get<vector<T>>(this->grupos).emplace_back(forward<Args>(args)...);
+            }
+            template <typename T>
+            vector<T> &de() {
+                return get<vector<T>>(this->grupos);
+            }
+            size_t size() const {
+                return get<vector<Perro>>(this->grupos).size() + get<vector<Persona>>(this->grupos).size();
+            }
+            // Visita todos los perros y luego todas las personas
+            template <typename Funcion>
+            void paraTodos(Funcion f) {
+                for (Perro &m : this->de<Perro>()) f(m);
+                for (Persona &m : this->de<Persona>()) f(m);
+            }
+            void alimentarTodos(int racion) {
+                this->paraTodos([racion](auto &m) { m.alimentar(racion); });
+            }
+        private:
+            tuple<vector<Perro>, vector<Persona>> grupos;
+    };
+
+}
+
+#endif
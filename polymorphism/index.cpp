@@ -1,61 +1,17 @@
 #include <iostream>
 #include <string>
-
-using namespace std;
-
-// Definiendo clase padre o super clase
-class Mamifero {
-    private:
-        int edad;
-    public:
-        Mamifero(int edad) {
-            this->edad = edad;
-        }
-        /**
-         * Tal como se define un prototipo de función, la palabra reservada
-         * virtual definirá al método polimórfico.
-         * 
-         * Más información:
-         * + https://www.geeksforgeeks.org/virtual-destructor/
-         */
-        virtual void comer() {
-            cout << "¡El mamífero está comiendo!" << endl;
-        }
-};
-
+#include <vector>
+#include "mamiferos.h"
 /**
- * Definiendo clases hijo.
- * 
- * Ahora, ambas clases hijo heredadan de la super clase y podrán
- * definir el método comer().
+ * Alternativa sin virtual para el conjunto cerrado Perro/Persona.
  */
-class Perro : public Mamifero {
-    private:
-        string nombre;
-    public:
-        Perro(string nombre, int edad) : Mamifero(edad) {
-            this->nombre = nombre;
-        }
-        void comer() {
-            cout << "Wof wof..." << endl;
-            // Invocando al método padre luego de haber ejecutado el bloque del hijo
-            Mamifero::comer();
-        }
-};
+#include "estatico.h"
+/**
+ * Mamíferos que reservan su memoria (incluyendo sus strings) en un recurso pmr.
+ */
+#include "poblacion.h"
 
-class Persona : public Mamifero {
-    private:
-        string oficio;
-    public:
-        Persona(string oficio, int edad) : Mamifero(edad) {
-            this->oficio = oficio;
-        }
-        void comer() {
-            // Invocando al método padre antes de ejecutar el bloque del hijo
-            Mamifero::comer();
-            cout << "Hey, soy humano y estoy comiendo..." << endl;
-        }
-};
+using namespace std;
 
 int main() {
 
@@ -67,6 +23,49 @@ int main() {
     mizu.comer();
     cout << endl;
     jose.comer();
+    cout << endl;
+
+    // Polimorfismo estático: misma sintaxis, guardados por valor en un vector
+    vector<estatico::Animal> animales = {
+        estatico::Perro("Mizu", 5),
+        estatico::Persona("Software Engineer", 23)
+    };
+    for (estatico::Animal &animal : animales) {
+        animal.comer();
+        animal.alimentar(10);
+        cout << "Energía: " << animal.getEnergia() << endl << endl;
+    }
+
+    // Agrupados por tipo: una sola decisión de tipo por grupo
+    estatico::Manada manada;
+    manada.agregar<estatico::Perro>("Mizu", 5);
+    manada.agregar<estatico::Perro>("Firulais", 3);
+    manada.agregar<estatico::Persona>("Software Engineer", 23);
+    manada.alimentarTodos(10);
+    int energiaTotal = 0;
+    manada.paraTodos([&energiaTotal](auto &m) { energiaTotal += m.getEnergia(); });
+    cout << "Energía total de la manada (" << manada.size() << " mamíferos): " << energiaTotal << endl << endl;
+
+    // Destruir por un puntero a la clase padre es seguro gracias al destructor virtual
+    Mamifero *mascota = new Perro("Mizu", 5);
+    mascota->comer();
+    delete mascota;
+    cout << endl;
+
+    /**
+     * Una población dentro de un buffer de la pila: ni los animales ni sus
+     * textos tocan el heap mientras quepan en los 4 KB.
+     */
+    char buffer[4096];
+    pmr::monotonic_buffer_resource pila(buffer, sizeof(buffer));
+    recurso::Poblacion poblacion(&pila);
+    poblacion.crear<recurso::Perro>("Mizu de la colonia Roma", 5);
+    poblacion.crear<recurso::Persona>("Software Engineer Senior", 23);
+    poblacion.paraCada([](recurso::Mamifero &m) { m.alimentar(10); });
+    cout << "Población de " << poblacion.size() << " mamíferos, energía del primero: " << poblacion[0].getEnergia() << endl;
+    // Todos se liberan de una sola vez, sin recorrerlos
+    poblacion.liberar();
+    cout << "Después de liberar: " << poblacion.size() << " mamíferos" << endl;
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/**
+ * Jerarquía de mamíferos del ejemplo de polimorfismo. Vive en su propio
+ * archivo de cabecera para poder reutilizarla desde los benchmarks (bench.cpp).
+ */
+#ifndef MAMIFEROS_H
+#define MAMIFEROS_H
+
+// Definiendo clase padre o super clase
+class Mamifero {
+    private:
+        int edad;
+    protected:
+        int energia = 0;
+    public:
+        Mamifero(int edad) {
+            this->edad = edad;
+        }
+        /**
+         * Sin un destructor virtual, 'delete m' con 'Mamifero *m = new Perro(...)'
+         * solo llamaría al destructor de Mamifero: el string del hijo nunca se
+         * liberaría (comportamiento indefinido). Con virtual, delete llama primero
+         * al destructor del hijo.
+         */
+        virtual ~Mamifero() = default;
+        /**
+         * Tal como se define un prototipo de función, la palabra reservada
+         * virtual definirá al método polimórfico.
+         *
+         * Más información:
+         * + https://www.geeksforgeeks.org/virtual-destructor/
+         */
+        virtual void comer() {
+            cout << "¡El mamífero está comiendo!" << endl;
+        }
+        // Versión silenciosa de comer(): solo acumula energía
+        virtual void alimentar(int racion) {
+            this->energia += racion;
+        }
+        int getEnergia() const {
+            return this->energia;
+        }
+};
+
+/**
+ * Definiendo clases hijo.
+ *
+ * Ahora, ambas clases hijo heredadan de la super clase y podrán
+ * definir el método comer().
+ */
+class Perro : public Mamifero {
+    private:
+        string nombre;
+    public:
+        Perro(string nombre, int edad) : Mamifero(edad) {
+            this->nombre = nombre;
+        }
+        void comer() {
+            cout << "Wof wof..." << endl;
+            // Invocando al método padre luego de haber ejecutado el bloque del hijo
+            Mamifero::comer();
+        }
+        void alimentar(int racion) {
+            this->energia += 2 * racion;
+        }
+};
+
+class Persona : public Mamifero {
+    private:
+        string oficio;
+    public:
+        Persona(string oficio, int edad) : Mamifero(edad) {
+            this->oficio = oficio;
+        }
+        void comer() {
+            // Invocando al método padre antes de ejecutar el bloque del hijo
+            Mamifero::comer();
+            cout << "Hey, soy humano y estoy comiendo..." << endl;
+        }
+        void alimentar(int racion) {
+            this->energia += racion + 1;
+        }
+};
+
+#endif
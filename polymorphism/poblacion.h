@@ -0,0 +1,163 @@
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Mamíferos con recursos de memoria polimórficos (std::pmr, C++17).
+ *
+ * Cada 'new Perro(...)' reserva el objeto en el heap global, y su string
+ * reserva otro bloque aparte. Destruir un millón de animales implica dos
+ * millones de llamadas a free().
+ *
+ * Un std::pmr::memory_resource decide de dónde sale la memoria. Las clases
+ * de este archivo reciben un allocator (polymorphic_allocator) y se lo pasan a
+ * sus strings, de modo que el objeto y su texto salen del mismo recurso:
+ *
+ * + monotonic_buffer_resource: solo avanza un cursor dentro de bloques
+ *   grandes; liberar un objeto no hace nada y release() suelta todo junto.
+ * + unsynchronized_pool_resource: casillas por tamaño con listas de libres;
+ *   permite liberar objetos sueltos y también soltar todo con release().
+ *
+ * Ambos recursos son para un solo hilo (sin sincronización).
+ */
+#ifndef POBLACION_H
+#define POBLACION_H
+
+namespace recurso {
+
+    class Mamifero {
+        private:
+            int edad;
+        protected:
+            int energia = 0;
+        public:
+            // Permite a los contenedores pmr pasar su allocator al construir (uses-allocator)
+            typedef pmr::polymorphic_allocator<byte> allocator_type;
+
+            Mamifero(int edad) {
+                this->edad = edad;
+            }
+            // Destruir por un puntero a Mamifero llama al destructor del hijo
+            virtual ~Mamifero() = default;
+            virtual void comer() {
+                cout << "¡El mamífero está comiendo!" << endl;
+            }
+            virtual void alimentar(int racion) {
+                this->energia += racion;
+            }
+            int getEnergia() const {
+                return this->energia;
+            }
+    };
+
+    class Perro : public Mamifero {
+        private:
+            pmr::string nombre;
+        public:
+            Perro(string_view nombre, int edad, allocator_type alloc = {}) : Mamifero(edad), nombre(nombre, alloc) {}
+            Perro(const Perro &otro, allocator_type alloc) : Mamifero(otro), nombre(otro.nombre, alloc) {}
+            void comer() {
+                cout << "Wof wof..." << endl;
+                Mamifero::comer();
+            }
+            void alimentar(int racion) {
+                this->energia += 2 * racion;
+            }
+            const pmr::string &getNombre() const {
+                return this->nombre;
+            }
+    };
+
+    class Persona : public Mamifero {
+        private:
+            pmr::string oficio;
+        public:
+            Persona(string_view oficio, int edad, allocator_type alloc = {}) : Mamifero(edad), oficio(oficio, alloc) {}
+            Persona(const Persona &otro, allocator_type alloc) : Mamifero(otro), oficio(otro.oficio, alloc) {}
+            void comer() {
+                Mamifero::comer();
+                cout << "Hey, soy humano y estoy comiendo..." << endl;
+            }
+            void alimentar(int racion) {
+                this->energia += racion + 1;
+            }
+            const pmr::string &getOficio() const {
+                return this->oficio;
+            }
+    };
+
+    /**
+     * Una población completa dentro de su propio recurso: los objetos, sus
+     * strings y el arreglo de punteros.
+     *
+     * liberar() no recorre a los animales: como todo lo que poseen salió del
+     * mismo recurso, basta con soltar los bloques del recurso (release), sin
+     * llamar destructores uno por uno. Por eso solo se deben crear aquí tipos
+     * cuya memoria dinámica provenga del allocator que reciben.
+     */
+    template <typename Recurso = pmr::monotonic_buffer_resource>
+    class PoblacionEn {
+        public:
+            explicit PoblacionEn(pmr::memory_resource *superior = pmr::get_default_resource())
+                : memoria(superior), miembros(&memoria) {}
+            PoblacionEn(const PoblacionEn &) = delete;
+            PoblacionEn &operator=(const PoblacionEn &) = delete;
+            ~PoblacionEn() {
+                this->liberar();
+            }
+
+            template <typename T, typename... Args>
+            T *crear(Args &&... args) {
+                pmr::polymorphic_allocator<T> alloc(&this->memoria);
+                T *animal = alloc.allocate(1);
+                try {
+                    ::new (animal) T(forward<Args>(args)..., Mamifero::allocator_type(&this->memoria));
+                } catch (...) {
+                    alloc.deallocate(animal, 1);
+                    throw;
+                }
+                this->miembros.push_back(animal);
+                return animal;
+            }
+
+            void reservar(size_t cantidad) {
+                this->miembros.reserve(cantidad);
+            }
+            size_t size() const {
+                return this->miembros.size();
+            }
+            Mamifero &operator[](size_t i) {
+                return *this->miembros[i];
+            }
+            template <typename Funcion>
+            void paraCada(Funcion f) {
+                for (Mamifero *m : this->miembros) f(*m);
+            }
+
+            // Suelta a toda la población de una vez
+            void liberar() {
+                // El arreglo también vive en el recurso: se vacía antes de soltarlo
+                this->miembros = pmr::vector<Mamifero *>(&this->memoria);
+                this->memoria.release();
+            }
+
+            Recurso &recursoMemoria() {
+                return this->memoria;
+            }
+        private:
+            Recurso memoria;
+            pmr::vector<Mamifero *> miembros;
+    };
+
+    typedef PoblacionEn<pmr::monotonic_buffer_resource> Poblacion;
+
+}
+
+#endif
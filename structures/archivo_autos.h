@@ -0,0 +1,268 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "auto_compacto.h"
+
+using namespace std;
+
+/**
+ * Formato binario plano para colecciones de autos.
+ *
+ * Guardar los autos como texto obliga a leer y convertir cada línea al
+ * cargar. En este formato el archivo tiene exactamente la misma forma que los
+ * datos en memoria, así que basta con proyectarlo con mmap() y usarlo en su
+ * lugar: abrir un archivo de 10 GB toma lo mismo que abrir uno de 10 KB, y el
+ * sistema operativo trae a memoria solo las páginas que se van leyendo.
+ *
+ *   desplazamiento 0    encabezado (64 bytes): firma, versión, tamaños
+ *   desplazamiento 64   registros AutoCompacto de 16 bytes
+ *   múltiplo de 64      marcas largas (derramadas), una tras otra
+ *
+ * Los números se guardan en el orden de bytes de la máquina (little-endian en
+ * x86); el encabezado incluye un valor conocido para detectar archivos
+ * escritos en una máquina con otro orden.
+ */
+#ifndef ARCHIVO_AUTOS_H
+#define ARCHIVO_AUTOS_H
+
+struct EncabezadoArchivoAutos {
+    static constexpr char FIRMA[8] = { 'A', 'U', 'T', 'O', 'S', 'B', 'I', 'N' };
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t ORDEN_BYTES = 0x01020304;
+    static constexpr uint64_t ALINEACION = 64;
+
+    char firma[8];
+    uint32_t version;
+    uint32_t tamanioRegistro;
+    uint32_t ordenBytes;
+    uint32_t reservado;
+    uint64_t registros;
+    uint64_t desplazamientoRegistros;
+    uint64_t desplazamientoTextos;
+    uint64_t bytesTextos;
+    uint64_t reservado2;
+};
+
+static_assert(sizeof(EncabezadoArchivoAutos) == EncabezadoArchivoAutos::ALINEACION, "El encabezado ocupa una línea de caché");
+static_assert(is_trivially_copyable<EncabezadoArchivoAutos>::value, "El encabezado se escribe tal cual");
+
+/**
+ * Escribe un archivo de autos registro por registro, sin tener la colección
+ * completa en memoria (solo las marcas derramadas, que son pocas).
+ *
+ * Se escribe en 'ruta.tmp' y al cerrar se renombra a 'ruta': quien abra el
+ * archivo nunca verá uno a medio escribir.
+ */
+class EscritorArchivoAutos {
+    public:
+        explicit EscritorArchivoAutos(const string &ruta) {
+            this->ruta = ruta;
+            this->archivo = fopen((ruta + ".tmp").c_str(), "wb");
+            if (this->archivo == nullptr) throw runtime_error("No se pudo crear el archivo " + ruta);
+            // El encabezado real se escribe al cerrar, cuando se conocen los tamaños
+            EncabezadoArchivoAutos vacio = {};
+            fwrite(&vacio, sizeof(vacio), 1, this->archivo);
+            this->buffer.reserve(REGISTROS_POR_BLOQUE);
+        }
+        EscritorArchivoAutos(const EscritorArchivoAutos &) = delete;
+        EscritorArchivoAutos &operator=(const EscritorArchivoAutos &) = delete;
+        ~EscritorArchivoAutos() {
+            if (this->archivo != nullptr) {
+                // Sin cerrar() el archivo temporal se descarta
+                fclose(this->archivo);
+                remove((this->ruta + ".tmp").c_str());
+            }
+        }
+
+        void agregar(string_view marca, int puertas, bool isNew = true) {
+            this->buffer.push_back(codificarAuto(marca, puertas, isNew, this->derramadas));
+            if (this->buffer.size() == REGISTROS_POR_BLOQUE) this->vaciar();
+        }
+        void agregar(const Auto &a) {
+            this->agregar(a.marca, a.puertas, a.isNew);
+        }
+
+        void cerrar() {
+            this->vaciar();
+            EncabezadoArchivoAutos e = {};
+            memcpy(e.firma, EncabezadoArchivoAutos::FIRMA, sizeof(e.firma));
+            e.version = EncabezadoArchivoAutos::VERSION;
+            e.tamanioRegistro = sizeof(AutoCompacto);
+            e.ordenBytes = EncabezadoArchivoAutos::ORDEN_BYTES;
+            e.registros = this->registros;
+            e.desplazamientoRegistros = sizeof(EncabezadoArchivoAutos);
+            uint64_t finRegistros = e.desplazamientoRegistros + this->registros * sizeof(AutoCompacto);
+            e.desplazamientoTextos = alinear(finRegistros);
+            e.bytesTextos = this->derramadas.size();
+
+            static const char ceros[EncabezadoArchivoAutos::ALINEACION] = {};
+            fwrite(ceros, 1, e.desplazamientoTextos - finRegistros, this->archivo);
+            fwrite(this->derramadas.data(), 1, this->derramadas.size(), this->archivo);
+            fseek(this->archivo, 0, SEEK_SET);
+            fwrite(&e, sizeof(e), 1, this->archivo);
+
+            bool error = ferror(this->archivo) != 0;
+            error = fclose(this->archivo) != 0 || error;
+            this->archivo = nullptr;
+            string temporal = this->ruta + ".tmp";
+            if (error || rename(temporal.c_str(), this->ruta.c_str()) != 0) {
+                remove(temporal.c_str());
+                throw runtime_error("No se pudo escribir el archivo " + this->ruta);
+            }
+        }
+
+        static uint64_t alinear(uint64_t desplazamiento) {
+            uint64_t a = EncabezadoArchivoAutos::ALINEACION;
+            return (desplazamiento + a - 1) / a * a;
+        }
+    private:
+        static constexpr size_t REGISTROS_POR_BLOQUE = 65536;
+
+        string ruta;
+        FILE *archivo;
+        vector<AutoCompacto> buffer;
+        vector<char> derramadas;
+        uint64_t registros = 0;
+
+        void vaciar() {
+            fwrite(this->buffer.data(), sizeof(AutoCompacto), this->buffer.size(), this->archivo);
+            this->registros += this->buffer.size();
+            this->buffer.clear();
+        }
+};
+
+inline void guardarAutos(const AutosCompactos &autos, const string &ruta) {
+    EscritorArchivoAutos escritor(ruta);
+    for (size_t i = 0; i < autos.size(); i++) escritor.agregar(autos.marca(i), autos.puertas(i), autos.isNew(i));
+    escritor.cerrar();
+}
+
+/**
+ * Vista de solo lectura sobre un archivo de autos proyectado en memoria. Al
+ * abrir solo se valida el encabezado; los registros se leen directamente del
+ * archivo, sin copiarlos ni convertirlos.
+ */
+class VistaArchivoAutos {
+    public:
+        explicit VistaArchivoAutos(const string &ruta) {
+            int fd = open(ruta.c_str(), O_RDONLY);
+            if (fd < 0) throw runtime_error("No se pudo abrir " + ruta);
+            struct stat info;
+            if (fstat(fd, &info) != 0 || size_t(info.st_size) < sizeof(EncabezadoArchivoAutos)) {
+                close(fd);
+                throw runtime_error("Archivo de autos incompleto: " + ruta);
+            }
+            this->bytes = info.st_size;
+            void *datos = mmap(nullptr, this->bytes, PROT_READ, MAP_SHARED, fd, 0);
+            // El mapeo sigue siendo válido después de cerrar el descriptor
+            close(fd);
+            if (datos == MAP_FAILED) throw runtime_error("No se pudo proyectar " + ruta);
+            this->base = static_cast<const char *>(datos);
+            try {
+                this->validar(ruta);
+            } catch (...) {
+                munmap(const_cast<char *>(this->base), this->bytes);
+                throw;
+            }
+            this->registros = reinterpret_cast<const AutoCompacto *>(this->base + this->encabezado().desplazamientoRegistros);
+            this->textos = this->base + this->encabezado().desplazamientoTextos;
+        }
+        VistaArchivoAutos(VistaArchivoAutos &&otra) noexcept {
+            *this = move(otra);
+        }
+        VistaArchivoAutos &operator=(VistaArchivoAutos &&otra) noexcept {
+            swap(this->base, otra.base);
+            swap(this->bytes, otra.bytes);
+            swap(this->registros, otra.registros);
+            swap(this->textos, otra.textos);
+            return *this;
+        }
+        VistaArchivoAutos(const VistaArchivoAutos &) = delete;
+        VistaArchivoAutos &operator=(const VistaArchivoAutos &) = delete;
+        ~VistaArchivoAutos() {
+            if (this->base != nullptr) munmap(const_cast<char *>(this->base), this->bytes);
+        }
+
+        const EncabezadoArchivoAutos &encabezado() const {
+            return *reinterpret_cast<const EncabezadoArchivoAutos *>(this->base);
+        }
+        size_t size() const {
+            return this->encabezado().registros;
+        }
+        const AutoCompacto &operator[](size_t i) const {
+            return this->registros[i];
+        }
+        const AutoCompacto *begin() const {
+            return this->registros;
+        }
+        const AutoCompacto *end() const {
+            return this->registros + this->size();
+        }
+
+        /**
+         * Revisar cada registro al abrir sería volver a "procesar" el archivo,
+         * así que los límites de una marca derramada se revisan al leerla. Se
+         * comparan como enteros antes de formar el puntero: un desplazamiento
+         * corrupto apuntaría fuera del mapeo, y ese puntero ya no se podría
+         * comparar de forma válida.
+         */
+        string_view marca(size_t i) const {
+            const AutoCompacto &registro = this->registros[i];
+            if (!registro.derramada()) return registro.marca(this->textos);
+            uint64_t desplazamiento = registro.desplazamientoDerramada();
+            uint64_t longitud = registro.longitudDerramada();
+            uint64_t total = this->encabezado().bytesTextos;
+            if (desplazamiento > total || longitud > total - desplazamiento) {
+                throw runtime_error("Marca derramada fuera del archivo");
+            }
+            return string_view(this->textos + desplazamiento, longitud);
+        }
+        unsigned puertas(size_t i) const {
+            return this->registros[i].puertas();
+        }
+        bool isNew(size_t i) const {
+            return this->registros[i].isNew();
+        }
+
+        // Aviso al sistema operativo: se leerá de principio a fin (lectura anticipada agresiva)
+        void recorridoSecuencial() const {
+            madvise(const_cast<char *>(this->base), this->bytes, MADV_SEQUENTIAL);
+        }
+    private:
+        const char *base = nullptr;
+        size_t bytes = 0;
+        const AutoCompacto *registros = nullptr;
+        const char *textos = nullptr;
+
+        void validar(const string &ruta) const {
+            const EncabezadoArchivoAutos &e = this->encabezado();
+            if (memcmp(e.firma, EncabezadoArchivoAutos::FIRMA, sizeof(e.firma)) != 0) {
+                throw runtime_error(ruta + " no es un archivo de autos");
+            }
+            if (e.ordenBytes != EncabezadoArchivoAutos::ORDEN_BYTES) {
+                throw runtime_error(ruta + " fue escrito con otro orden de bytes");
+            }
+            if (e.version != EncabezadoArchivoAutos::VERSION) {
+                throw runtime_error(ruta + ": versión " + to_string(e.version) + " no soportada");
+            }
+            if (e.tamanioRegistro != sizeof(AutoCompacto) || e.desplazamientoRegistros % alignof(AutoCompacto) != 0) {
+                throw runtime_error(ruta + ": disposición de registros incompatible");
+            }
+            // Se comparan por separado para evitar desbordamientos con valores corruptos
+            uint64_t maximo = this->bytes;
+            if (e.desplazamientoRegistros > maximo || e.registros > (maximo - e.desplazamientoRegistros) / sizeof(AutoCompacto) ||
+                e.desplazamientoTextos > maximo || e.bytesTextos > maximo - e.desplazamientoTextos) {
+                throw runtime_error(ruta + ": tamaños fuera del archivo");
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,37 @@
+#include <iostream>
+#include <cstring>
+
+using namespace std;
+
+#ifndef AUTO_H
+#define AUTO_H
+
+/**
+ * Un registro (o estructura) es una agrupación de datos del mismo o diferentes
+ * tipos definida por la palabra reservada 'struct'. Esta estructura de datos funciona
+ * por debajo con punteros.
+ * 
+ * Estructura de datos llamada Auto.
+ */
+struct Auto {
+
+    /**
+     * Como se puede osbervar, una estructura puede tener miembros que describan
+     * el valor de una propiedad o funciones que puedan acceder al scope de la
+     * estructura misma de una forma completamente abstracta y encapsulada. Todos
+     * los miembros de la estructura son de acceso público.
+     * 
+     * Este concepto es el preámbulo a la Programación Orientada a Objetos (POO).
+     */
+
+    bool isNew = true;
+    char marca[50];
+    int puertas;
+
+    void arrancar() {
+        cout << "Encendiendo auto " << marca << "..." << endl;
+    }
+    
+};
+
+#endif
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "auto.h"
+
+using namespace std;
+
+/**
+ * Representación compacta de Auto para colecciones enormes.
+ *
+ * El compilador alinea cada miembro a su tamaño, y Auto queda así:
+ *
+ *   isNew [1] marca [50] relleno [1] puertas [4]  = 56 bytes
+ *
+ * Reordenar los miembros (int, char[50], bool) no ahorra nada: 55 bytes de
+ * datos se redondean a 56 por la alineación de int. Lo que sí desperdicia es
+ * reservar 50 bytes para marcas que casi siempre miden menos de 12.
+ *
+ * AutoCompacto ocupa 16 bytes (4 registros por línea de caché de 64 bytes):
+ *
+ *   texto [14]  metadatos [2]
+ *
+ * + Las marcas de hasta 14 caracteres se guardan dentro del registro.
+ * + Las más largas se "derraman" a un arreglo de textos aparte y el registro
+ *   guarda su desplazamiento y longitud en los primeros 8 bytes de 'texto'.
+ * + Los metadatos empaquetan en 16 bits: longitud en línea (4 bits), puertas
+ *   (4 bits, 0 a 15), isNew (1 bit) y si la marca está derramada (1 bit).
+ */
+#ifndef AUTO_COMPACTO_H
+#define AUTO_COMPACTO_H
+
+struct AutoCompacto {
+    static constexpr size_t CAPACIDAD_EN_LINEA = 14;
+    static constexpr unsigned MAXIMO_PUERTAS = 15;
+
+    char texto[CAPACIDAD_EN_LINEA];
+    uint16_t metadatos;
+
+    // Posición de cada campo dentro de 'metadatos'
+    static constexpr unsigned BIT_LONGITUD = 0;
+    static constexpr unsigned BIT_PUERTAS = 4;
+    static constexpr unsigned BIT_NUEVO = 8;
+    static constexpr unsigned BIT_DERRAMADA = 9;
+
+    unsigned longitudEnLinea() const { return (metadatos >> BIT_LONGITUD) & 0xF; }
+    unsigned puertas() const { return (metadatos >> BIT_PUERTAS) & 0xF; }
+    bool isNew() const { return (metadatos >> BIT_NUEVO) & 1; }
+    bool derramada() const { return (metadatos >> BIT_DERRAMADA) & 1; }
+
+    // Dónde quedó una marca derramada dentro del arreglo de marcas largas
+    uint32_t desplazamientoDerramada() const {
+        uint32_t desplazamiento;
+        memcpy(&desplazamiento, texto, sizeof(desplazamiento));
+        return desplazamiento;
+    }
+    uint32_t longitudDerramada() const {
+        uint32_t longitud;
+        memcpy(&longitud, texto + sizeof(uint32_t), sizeof(longitud));
+        return longitud;
+    }
+
+    // 'derramadas' es el arreglo de marcas largas de la colección a la que pertenece
+    string_view marca(const char *derramadas) const {
+        if (!this->derramada()) return string_view(texto, this->longitudEnLinea());
+        return string_view(derramadas + this->desplazamientoDerramada(), this->longitudDerramada());
+    }
+};
+
+// Verificación de la disposición en tiempo de compilación
+static_assert(sizeof(AutoCompacto) == 16, "AutoCompacto debe ocupar 16 bytes");
+static_assert(alignof(AutoCompacto) <= 2, "AutoCompacto no debe agregar relleno por alineación");
+static_assert(offsetof(AutoCompacto, metadatos) == AutoCompacto::CAPACIDAD_EN_LINEA, "Sin relleno entre texto y metadatos");
+static_assert(is_trivially_copyable<AutoCompacto>::value, "AutoCompacto debe poder copiarse con memcpy");
+static_assert(AutoCompacto::CAPACIDAD_EN_LINEA >= 2 * sizeof(uint32_t), "El texto debe poder guardar desplazamiento y longitud");
+static_assert(AutoCompacto::CAPACIDAD_EN_LINEA < 16, "La longitud en línea se guarda en 4 bits");
+
+/**
+ * Construye el registro compacto de un auto. Si la marca no cabe en línea, se
+ * agrega al final de 'derramadas' y el registro guarda dónde quedó.
+ */
+inline AutoCompacto codificarAuto(string_view marca, int puertas, bool isNew, vector<char> &derramadas) {
+    if (puertas < 0 || unsigned(puertas) > AutoCompacto::MAXIMO_PUERTAS) {
+        throw out_of_range("AutoCompacto guarda de 0 a 15 puertas");
+    }
+    AutoCompacto registro;
+    memset(&registro, 0, sizeof(registro));
+    uint16_t metadatos = uint16_t(puertas) << AutoCompacto::BIT_PUERTAS;
+    if (isNew) metadatos |= 1 << AutoCompacto::BIT_NUEVO;
+    if (marca.size() <= AutoCompacto::CAPACIDAD_EN_LINEA) {
+        memcpy(registro.texto, marca.data(), marca.size());
+        metadatos |= uint16_t(marca.size()) << AutoCompacto::BIT_LONGITUD;
+    } else {
+        if (derramadas.size() + marca.size() > UINT32_MAX) {
+            throw length_error("Las marcas derramadas exceden 4 GB");
+        }
+        uint32_t desplazamiento = derramadas.size(), longitud = marca.size();
+        derramadas.insert(derramadas.end(), marca.begin(), marca.end());
+        memcpy(registro.texto, &desplazamiento, sizeof(desplazamiento));
+        memcpy(registro.texto + sizeof(desplazamiento), &longitud, sizeof(longitud));
+        metadatos |= 1 << AutoCompacto::BIT_DERRAMADA;
+    }
+    registro.metadatos = metadatos;
+    return registro;
+}
+
+/**
+ * Colección de AutoCompacto más el arreglo de marcas derramadas.
+ */
+class AutosCompactos {
+    public:
+        size_t agregar(string_view marca, int puertas, bool isNew = true) {
+            this->registros.push_back(codificarAuto(marca, puertas, isNew, this->derramadas));
+            return this->registros.size() - 1;
+        }
+        size_t agregar(const Auto &a) {
+            return this->agregar(a.marca, a.puertas, a.isNew);
+        }
+        void reservar(size_t cantidad) {
+            this->registros.reserve(cantidad);
+        }
+
+        string_view marca(size_t i) const {
+            return this->registros[i].marca(this->derramadas.data());
+        }
+        unsigned puertas(size_t i) const {
+            return this->registros[i].puertas();
+        }
+        bool isNew(size_t i) const {
+            return this->registros[i].isNew();
+        }
+
+        // De regreso a la estructura original
+        Auto comoAuto(size_t i) const {
+            Auto a;
+            string_view m = this->marca(i);
+            size_t n = min(m.size(), sizeof(a.marca) - 1);
+            memcpy(a.marca, m.data(), n);
+            a.marca[n] = '\0';
+            a.puertas = this->puertas(i);
+            a.isNew = this->isNew(i);
+            return a;
+        }
+
+        size_t size() const {
+            return this->registros.size();
+        }
+        const vector<AutoCompacto> &getRegistros() const {
+            return this->registros;
+        }
+        const vector<char> &getDerramadas() const {
+            return this->derramadas;
+        }
+        size_t bytes() const {
+            return this->registros.size() * sizeof(AutoCompacto) + this->derramadas.size();
+        }
+    private:
+        vector<AutoCompacto> registros;
+        vector<char> derramadas;
+};
+
+/**
+ * Reporte de disposición: desplazamiento y tamaño de cada miembro de Auto y
+ * el relleno que agrega el compilador.
+ */
+inline void auditarDisposicionAuto() {
+    cout << "Auto: sizeof " << sizeof(Auto) << ", alignof " << alignof(Auto) << endl;
+    cout << "  isNew   desplazamiento " << offsetof(Auto, isNew) << ", " << sizeof(Auto::isNew) << " B" << endl;
+    cout << "  marca   desplazamiento " << offsetof(Auto, marca) << ", " << sizeof(Auto::marca) << " B" << endl;
+    cout << "  puertas desplazamiento " << offsetof(Auto, puertas) << ", " << sizeof(Auto::puertas) << " B" << endl;
+    size_t datos = sizeof(Auto::isNew) + sizeof(Auto::marca) + sizeof(Auto::puertas);
+    cout << "  relleno " << sizeof(Auto) - datos << " B" << endl;
+    cout << "AutoCompacto: sizeof " << sizeof(AutoCompacto) << ", alignof " << alignof(AutoCompacto)
+         << ", marcas de hasta " << AutoCompacto::CAPACIDAD_EN_LINEA << " caracteres en línea" << endl;
+}
+
+#endif
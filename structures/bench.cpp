@@ -0,0 +1,207 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "auto.h"
+#include "auto_compacto.h"
+#include "archivo_autos.h"
+#include "indice_marcas.h"
+
+using namespace std;
+
+// Marcas de prueba: casi todas cortas y una de cada 50 más larga que 14 caracteres
+const char *MARCAS[] = { "Volkswagen", "Nissan", "Kia", "Ford", "Toyota", "Honda", "Mazda", "Mercedes-Benz" };
+const char *MARCA_LARGA = "Automobili Lamborghini S.p.A.";
+
+const char *marcaDe(size_t i) {
+    return i % 50 == 49 ? MARCA_LARGA : MARCAS[(i * 2654435761u >> 8) % 8];
+}
+
+template <typename Funcion>
+double medirMs(Funcion f) {
+    auto inicio = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+/**
+ * Memoria y velocidad de recorrido de vector<Auto> contra AutosCompactos.
+ */
+void benchCompacto() {
+    const size_t N = 20000000;
+
+    vector<Auto> autos;
+    AutosCompactos compactos;
+    double crearAutos = medirMs([&]() {
+        autos.reserve(N);
+        for (size_t i = 0; i < N; i++) {
+            Auto a;
+            strcpy(a.marca, marcaDe(i));
+            a.puertas = 2 + 2 * (i % 2);
+            a.isNew = i % 3 == 0;
+            autos.push_back(a);
+        }
+    });
+    double crearCompactos = medirMs([&]() {
+        compactos.reservar(N);
+        for (size_t i = 0; i < N; i++) compactos.agregar(marcaDe(i), 2 + 2 * (i % 2), i % 3 == 0);
+    });
+
+    // Recorrido de campos pequeños: autos nuevos de 4 puertas
+    size_t nuevosAutos = 0, nuevosCompactos = 0;
+    double nuevosMsAutos = medirMs([&]() {
+        for (const Auto &a : autos) nuevosAutos += a.isNew && a.puertas == 4;
+    });
+    double nuevosMsCompactos = medirMs([&]() {
+        for (const AutoCompacto &r : compactos.getRegistros()) nuevosCompactos += r.isNew() && r.puertas() == 4;
+    });
+
+    // Recorrido por marca
+    size_t nissanAutos = 0, nissanCompactos = 0;
+    double marcaMsAutos = medirMs([&]() {
+        for (const Auto &a : autos) nissanAutos += strcmp(a.marca, "Nissan") == 0;
+    });
+    double marcaMsCompactos = medirMs([&]() {
+        for (size_t i = 0; i < compactos.size(); i++) nissanCompactos += compactos.marca(i) == "Nissan";
+    });
+
+    cout << N << " autos\t\t\tvector<Auto>\tAutosCompactos" << endl;
+    cout << "Memoria (MiB)\t\t\t" << autos.size() * sizeof(Auto) / 1048576 << "\t\t" << compactos.bytes() / 1048576 << endl;
+    cout << "Crear (ms)\t\t\t" << crearAutos << "\t\t" << crearCompactos << endl;
+    cout << "Nuevos de 4 puertas (ms)\t" << nuevosMsAutos << "\t\t" << nuevosMsCompactos
+         << (nuevosAutos == nuevosCompactos ? "" : "  (!)") << endl;
+    cout << "Marca == Nissan (ms)\t\t" << marcaMsAutos << "\t\t" << marcaMsCompactos
+         << (nissanAutos == nissanCompactos ? "" : "  (!)") << endl;
+}
+
+/**
+ * Cargar autos desde texto (una línea "marca,puertas,nuevo" por auto) contra
+ * proyectar el archivo binario. Ambos archivos se acaban de escribir, así que
+ * están en el caché de páginas del sistema: se compara el procesamiento, no
+ * el disco.
+ */
+void benchArchivo() {
+    const size_t N = 10000000;
+    const string rutaTexto = "/tmp/autos_bench.csv", rutaBinario = "/tmp/autos_bench.bin";
+
+    double escribirTexto = medirMs([&]() {
+        ofstream texto(rutaTexto);
+        for (size_t i = 0; i < N; i++) texto << marcaDe(i) << ',' << 2 + 2 * (i % 2) << ',' << (i % 3 == 0) << '\n';
+    });
+    double escribirBinario = medirMs([&]() {
+        EscritorArchivoAutos escritor(rutaBinario);
+        for (size_t i = 0; i < N; i++) escritor.agregar(marcaDe(i), 2 + 2 * (i % 2), i % 3 == 0);
+        escritor.cerrar();
+    });
+
+    // Tiempo hasta poder consultar el primer auto
+    AutosCompactos desdeTexto;
+    double cargarTexto = medirMs([&]() {
+        ifstream texto(rutaTexto);
+        string linea;
+        desdeTexto.reservar(N);
+        while (getline(texto, linea)) {
+            size_t coma1 = linea.find(','), coma2 = linea.find(',', coma1 + 1);
+            desdeTexto.agregar(string_view(linea).substr(0, coma1), stoi(linea.substr(coma1 + 1, coma2 - coma1 - 1)),
+                               linea[coma2 + 1] == '1');
+        }
+    });
+    VistaArchivoAutos *binario = nullptr;
+    double abrirBinario = medirMs([&]() {
+        binario = new VistaArchivoAutos(rutaBinario);
+    });
+
+    size_t nissanTexto = 0, nissanBinario = 0;
+    double recorrerTexto = medirMs([&]() {
+        for (size_t i = 0; i < desdeTexto.size(); i++) nissanTexto += desdeTexto.marca(i) == "Nissan";
+    });
+    double recorrerBinario = medirMs([&]() {
+        binario->recorridoSecuencial();
+        for (size_t i = 0; i < binario->size(); i++) nissanBinario += binario->marca(i) == "Nissan";
+    });
+
+    cout << N << " autos\t\t\tTexto\t\tBinario (mmap)" << endl;
+    ifstream t(rutaTexto, ios::ate | ios::binary), b(rutaBinario, ios::ate | ios::binary);
+    cout << "Archivo (MiB)\t\t\t" << t.tellg() / 1048576 << "\t\t" << b.tellg() / 1048576 << endl;
+    cout << "Escribir (ms)\t\t\t" << escribirTexto << "\t\t" << escribirBinario << endl;
+    cout << "Cargar (ms)\t\t\t" << cargarTexto << "\t\t" << abrirBinario << endl;
+    cout << "Marca == Nissan (ms)\t\t" << recorrerTexto << "\t\t" << recorrerBinario
+         << (nissanTexto == nissanBinario && binario->size() == N ? "" : "  (!)") << endl;
+
+    delete binario;
+    remove(rutaTexto.c_str());
+    remove(rutaBinario.c_str());
+}
+
+/**
+ * Búsquedas puntuales por marca: IndiceMarcas contra unordered_map. Cada auto
+ * tiene una marca distinta ("A0", "A1", ...) para que la tabla tenga tantas
+ * claves como registros. Las consultas van en orden aleatorio, así que casi
+ * todas fallan en caché: se mide la latencia, no el recorrido.
+ */
+void benchIndice() {
+    const size_t N = 20000000, CONSULTAS = 2000000;
+
+    AutosCompactos autos;
+    autos.reservar(N);
+    for (size_t i = 0; i < N; i++) autos.agregar("A" + to_string(i), 4);
+
+    IndiceMarcas<> indice(autos);
+    double construirIndice = medirMs([&]() {
+        indice.reservar(N);
+        indice.construir();
+    });
+    unordered_map<string_view, uint32_t> mapa;
+    double construirMapa = medirMs([&]() {
+        mapa.reserve(N);
+        for (size_t i = 0; i < N; i++) mapa.emplace(autos.marca(i), uint32_t(i));
+    });
+
+    // La mitad de las consultas existen y la otra mitad no
+    mt19937 aleatorio(42);
+    vector<string> consultas;
+    consultas.reserve(CONSULTAS);
+    for (size_t i = 0; i < CONSULTAS; i++) consultas.push_back((i % 2 ? "A" : "B") + to_string(aleatorio() % N));
+
+    size_t encontradosIndice = 0, encontradosMapa = 0;
+    double buscarIndice = medirMs([&]() {
+        for (const string &c : consultas) encontradosIndice += indice.buscar(c) != IndiceMarcas<>::NINGUNO;
+    });
+    double buscarMapa = medirMs([&]() {
+        for (const string &c : consultas) encontradosMapa += mapa.find(c) != mapa.end();
+    });
+    size_t encontradosRecorrido = 0;
+    double recorrido = medirMs([&]() {
+        for (size_t i = 0; i < autos.size(); i++) encontradosRecorrido += autos.marca(i) == consultas[1];
+    });
+
+    // unordered_map: un nodo por clave (siguiente, clave, valor y hash) más un arreglo de cubetas
+    size_t bytesMapa = mapa.size() * (sizeof(void *) + sizeof(pair<string_view, uint32_t>) + sizeof(size_t)) +
+                       mapa.bucket_count() * sizeof(void *);
+
+    cout << N << " marcas distintas\tIndiceMarcas\tunordered_map" << endl;
+    cout << "Memoria (MiB)\t\t\t" << indice.bytes() / 1048576 << "\t\t~" << bytesMapa / 1048576 << endl;
+    cout << "Construir (ms)\t\t\t" << construirIndice << "\t\t" << construirMapa << endl;
+    cout << "Búsqueda (ns)\t\t\t" << buscarIndice * 1e6 / CONSULTAS << "\t\t" << buscarMapa * 1e6 / CONSULTAS
+         << (encontradosIndice == encontradosMapa && encontradosIndice == CONSULTAS / 2 ? "" : "  (!)") << endl;
+    cout << "Una búsqueda recorriendo (ms)\t" << recorrido << (encontradosRecorrido == 1 ? "" : "  (!)") << endl;
+}
+
+int main() {
+
+    auditarDisposicionAuto();
+    cout << endl;
+    benchCompacto();
+    cout << endl;
+    benchArchivo();
+    cout << endl;
+    benchIndice();
+
+    return 0;
+}
@@ -1,36 +1,25 @@
 #include <iostream>
 // Utilidades para manipulación de arreglos de caracteres (cadenas de texto)
 #include <cstring>
-
-using namespace std;
-
 /**
- * Un registro (o estructura) es una agrupación de datos del mismo o diferentes
- * tipos definida por la palabra reservada 'struct'. Esta estructura de datos funciona
- * por debajo con punteros.
- * 
- * Estructura de datos llamada Auto.
+ * La estructura Auto vive en su propio archivo de cabecera para poder
+ * reutilizarla desde los benchmarks (bench.cpp).
  */
-struct Auto {
-
-    /**
-     * Como se puede osbervar, una estructura puede tener miembros que describan
-     * el valor de una propiedad o funciones que puedan acceder al scope de la
-     * estructura misma de una forma completamente abstracta y encapsulada. Todos
-     * los miembros de la estructura son de acceso público.
-     * 
-     * Este concepto es el preámbulo a la Programación Orientada a Objetos (POO).
-     */
-
-    bool isNew = true;
-    char marca[50];
-    int puertas;
+#include "auto.h"
+/**
+ * Representación de 16 bytes para colecciones con millones de autos.
+ */
+#include "auto_compacto.h"
+/**
+ * Archivo binario que se usa directamente desde disco con mmap().
+ */
+#include "archivo_autos.h"
+/**
+ * Índice hash por marca: buscar un auto sin recorrer toda la colección.
+ */
+#include "indice_marcas.h"
 
-    void arrancar() {
-        cout << "Encendiendo auto " << marca << "..." << endl;
-    }
-    
-};
+using namespace std;
 
 // Prototipo de función que recibe dos parámetros y retorna una estructura de datos llamada Auto
 Auto crearAuto(int, char[]);
@@ -74,6 +63,8 @@ int main() {
     cout << "Marca del auto 2: " << mustang.marca << endl;
     cout << "Marca del auto 3: " << frontier.marca << endl;
     cout << "Puertas del auto 4: " << prius->puertas << " puertas" << endl;
+    // Lo que se crea con new debe liberarse con delete, o la memoria queda ocupada hasta que termine el programa
+    delete prius;
 
     /**
      * Así mismo, el registro puede usarse como tipado de una función:
@@ -84,6 +75,40 @@ int main() {
     // Llamando función dentro de estructura
     rio.arrancar();
 
+    cout << endl;
+
+    // Disposición en memoria de Auto y de su versión compacta
+    auditarDisposicionAuto();
+    AutosCompactos compactos;
+    compactos.agregar(jetta);
+    compactos.agregar(frontier);
+    compactos.agregar("Automobili Lamborghini S.p.A.", 2, false);
+    for (size_t i = 0; i < compactos.size(); i++) {
+        cout << "Auto compacto " << i << ": " << compactos.marca(i) << ", " << compactos.puertas(i) << " puertas"
+             << (compactos.getRegistros()[i].derramada() ? " (marca derramada)" : "") << endl;
+    }
+    compactos.comoAuto(2).arrancar();
+
+    // Guardar en formato binario y leerlo sin convertir nada
+    guardarAutos(compactos, "/tmp/autos.bin");
+    VistaArchivoAutos archivo("/tmp/autos.bin");
+    cout << "Archivo de autos: versión " << archivo.encabezado().version << ", " << archivo.size() << " registros" << endl;
+    for (size_t i = 0; i < archivo.size(); i++) {
+        cout << "Auto en archivo " << i << ": " << archivo.marca(i) << ", " << archivo.puertas(i) << " puertas" << endl;
+    }
+
+    // Búsqueda por marca con un índice en lugar de comparar cada auto con strcmp
+    compactos.agregar(mustang);
+    compactos.agregar("Nissan", 2, false);
+    IndiceMarcas<> porMarca(compactos);
+    porMarca.construir();
+    cout << "Autos Nissan:";
+    porMarca.paraCada("Nissan", [](uint32_t id) { cout << " " << id; });
+    cout << endl;
+    porMarca.eliminar(1);
+    cout << "Autos Nissan después de eliminar el 1: " << porMarca.contar("Nissan") << endl;
+    cout << "¿Hay algún Tesla? " << (porMarca.buscar("Tesla") == IndiceMarcas<>::NINGUNO ? "no" : "sí") << endl;
+
     return 0;
 }
 
@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "auto_compacto.h"
+
+using namespace std;
+
+/**
+ * Índice secundario por marca sobre una colección de autos.
+ *
+ * Buscar una marca con strcmp recorre toda la colección. El índice es una
+ * tabla hash de direccionamiento abierto (open addressing) al estilo de las
+ * "tablas suizas": en lugar de nodos y punteros como std::unordered_map, usa
+ * dos arreglos planos:
+ *
+ *   etiquetas [capacidad]  1 byte por casilla: vacía, borrada o 7 bits del hash
+ *   ids       [capacidad]  id (32 bits) del registro cuya marca ocupa la casilla
+ *
+ * Las casillas se revisan en grupos de 16: una sola comparación SIMD (SSE2)
+ * compara las 16 etiquetas contra los 7 bits del hash buscado, y solo las
+ * coincidencias (casi siempre una o ninguna) comparan la marca completa. La
+ * marca no se copia al índice; se lee de la colección con autos.marca(id).
+ *
+ * Una misma marca suele repetirse en muchos registros: la tabla guarda una
+ * casilla por marca distinta y los demás registros con esa marca se enlazan
+ * en una lista doble (arreglos 'siguiente' y 'anterior' indexados por id),
+ * así que insertar y eliminar un registro son O(1).
+ *
+ * 'Coleccion' es cualquier tipo con marca(i) y size(), p. ej. AutosCompactos
+ * o VistaArchivoAutos. El índice guarda una referencia: la colección debe
+ * vivir más que el índice.
+ */
+#ifndef INDICE_MARCAS_H
+#define INDICE_MARCAS_H
+
+template <typename Coleccion = AutosCompactos>
+class IndiceMarcas {
+    public:
+        static constexpr uint32_t NINGUNO = UINT32_MAX;
+        static constexpr size_t TAMANIO_GRUPO = 16;
+
+        explicit IndiceMarcas(const Coleccion &autos) : autos(autos) {
+            this->rehacer(1);
+        }
+
+        // Indexa todos los registros de la colección (descarta lo anterior)
+        void construir() {
+            size_t n = this->autos.size();
+            if (n >= FUERA) throw length_error("IndiceMarcas usa ids de 32 bits");
+            this->siguientes.assign(n, NINGUNO);
+            this->anteriores.assign(n, FUERA);
+            fill(this->etiquetas.begin(), this->etiquetas.end(), VACIA);
+            this->ocupadas = 0;
+            this->borradas = 0;
+            this->indexados = 0;
+            // En orden inverso para que cada lista quede en orden ascendente de id
+            for (size_t id = n; id-- > 0;) this->insertar(uint32_t(id));
+        }
+
+        // Prepara la tabla para 'marcas' marcas distintas sin crecer
+        void reservar(size_t marcas) {
+            size_t casillas = marcas + marcas / 7 + 1;
+            size_t grupos = 1;
+            while (grupos * TAMANIO_GRUPO < casillas) grupos *= 2;
+            if (grupos > this->grupos) this->rehacer(grupos);
+        }
+
+        // El registro queda al inicio de la lista de su marca
+        void insertar(uint32_t id) {
+            if (id >= this->autos.size()) throw out_of_range("El registro no existe en la colección");
+            if (id >= this->anteriores.size()) {
+                this->siguientes.resize(id + 1, NINGUNO);
+                this->anteriores.resize(id + 1, FUERA);
+            }
+            if (this->anteriores[id] != FUERA) throw runtime_error("El registro ya está indexado");
+
+            string_view marca = this->autos.marca(id);
+            size_t hash = this->hashDe(marca);
+            size_t casilla = this->encontrar(marca, hash);
+            this->anteriores[id] = NINGUNO;
+            if (casilla != NINGUNO) {
+                uint32_t cabeza = this->ids[casilla];
+                this->siguientes[id] = cabeza;
+                this->anteriores[cabeza] = id;
+                this->ids[casilla] = id;
+            } else {
+                this->siguientes[id] = NINGUNO;
+                if ((this->ocupadas + this->borradas + 1) * 8 > this->capacidad() * 7) {
+                    // Más de 7/8 ocupado: crece, o solo limpia si sobran casillas borradas
+                    this->rehacer(this->ocupadas * 2 >= this->capacidad() * 7 / 8 ? this->grupos * 2 : this->grupos);
+                }
+                this->colocar(hash, id);
+            }
+            this->indexados++;
+        }
+
+        // Regresa false si el registro no estaba indexado
+        bool eliminar(uint32_t id) {
+            if (id >= this->anteriores.size() || this->anteriores[id] == FUERA) return false;
+            uint32_t anterior = this->anteriores[id], siguiente = this->siguientes[id];
+            if (siguiente != NINGUNO) this->anteriores[siguiente] = anterior;
+            if (anterior != NINGUNO) {
+                this->siguientes[anterior] = siguiente;
+            } else {
+                // Era la cabeza: su casilla pasa al siguiente o se libera
+                string_view marca = this->autos.marca(id);
+                size_t casilla = this->encontrar(marca, this->hashDe(marca));
+                if (siguiente != NINGUNO) this->ids[casilla] = siguiente;
+                else this->liberar(casilla);
+            }
+            this->anteriores[id] = FUERA;
+            this->siguientes[id] = NINGUNO;
+            this->indexados--;
+            return true;
+        }
+
+        // Primer registro con la marca, o NINGUNO; los demás se obtienen con siguiente()
+        uint32_t buscar(string_view marca) const {
+            size_t casilla = this->encontrar(marca, this->hashDe(marca));
+            return casilla == NINGUNO ? NINGUNO : this->ids[casilla];
+        }
+        uint32_t siguiente(uint32_t id) const {
+            return this->siguientes[id];
+        }
+        template <typename Funcion>
+        void paraCada(string_view marca, Funcion f) const {
+            for (uint32_t id = this->buscar(marca); id != NINGUNO; id = this->siguientes[id]) f(id);
+        }
+        size_t contar(string_view marca) const {
+            size_t total = 0;
+            this->paraCada(marca, [&total](uint32_t) { total++; });
+            return total;
+        }
+
+        // Registros indexados
+        size_t size() const {
+            return this->indexados;
+        }
+        // Marcas distintas
+        size_t marcas() const {
+            return this->ocupadas;
+        }
+        size_t capacidad() const {
+            return this->grupos * TAMANIO_GRUPO;
+        }
+        size_t bytes() const {
+            return this->capacidad() * (sizeof(uint8_t) + sizeof(uint32_t)) +
+                   (this->siguientes.size() + this->anteriores.size()) * sizeof(uint32_t);
+        }
+    private:
+        // Etiquetas: las casillas ocupadas guardan 7 bits del hash (bit alto en 0)
+        static constexpr uint8_t VACIA = 0x80;
+        static constexpr uint8_t BORRADA = 0xFE;
+        // Valor de 'anteriores' para un registro que no está en el índice
+        static constexpr uint32_t FUERA = NINGUNO - 1;
+
+        const Coleccion &autos;
+        vector<uint8_t> etiquetas;
+        vector<uint32_t> ids;
+        size_t grupos = 0;
+        size_t ocupadas = 0;
+        size_t borradas = 0;
+        vector<uint32_t> siguientes;
+        vector<uint32_t> anteriores;
+        size_t indexados = 0;
+
+        static size_t hashDe(string_view marca) {
+            return hash<string_view>()(marca);
+        }
+        static uint8_t etiquetaDe(size_t hash) {
+            return hash & 0x7F;
+        }
+        size_t grupoInicial(size_t hash) const {
+            return (hash >> 7) & (this->grupos - 1);
+        }
+
+        // Bit i encendido si la etiqueta i del grupo es igual a 'valor'
+        uint32_t coincidencias(size_t grupo, uint8_t valor) const {
+            const uint8_t *e = &this->etiquetas[grupo * TAMANIO_GRUPO];
+#if defined(__SSE2__)
+            __m128i bloque = _mm_loadu_si128(reinterpret_cast<const __m128i *>(e));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(bloque, _mm_set1_epi8(char(valor))));
+#else
+            uint32_t mascara = 0;
+            for (size_t i = 0; i < TAMANIO_GRUPO; i++) mascara |= uint32_t(e[i] == valor) << i;
+            return mascara;
+#endif
+        }
+        // Bit i encendido si la casilla i está vacía o borrada (bit alto en 1)
+        uint32_t disponibles(size_t grupo) const {
+            const uint8_t *e = &this->etiquetas[grupo * TAMANIO_GRUPO];
+#if defined(__SSE2__)
+            return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(e)));
+#else
+            uint32_t mascara = 0;
+            for (size_t i = 0; i < TAMANIO_GRUPO; i++) mascara |= uint32_t(e[i] >> 7) << i;
+            return mascara;
+#endif
+        }
+
+        /**
+         * Sondeo por grupos: se avanza 1, 2, 3... grupos (sondeo triangular,
+         * que con un número de grupos potencia de 2 visita todos). Un grupo con
+         * alguna casilla vacía termina la búsqueda: la marca se habría puesto ahí.
+         */
+        size_t encontrar(string_view marca, size_t hash) const {
+            uint8_t etiqueta = etiquetaDe(hash);
+            size_t grupo = this->grupoInicial(hash);
+            for (size_t paso = 1;; paso++) {
+                for (uint32_t c = this->coincidencias(grupo, etiqueta); c != 0; c &= c - 1) {
+                    size_t casilla = grupo * TAMANIO_GRUPO + __builtin_ctz(c);
+                    if (this->autos.marca(this->ids[casilla]) == marca) return casilla;
+                }
+                if (this->coincidencias(grupo, VACIA) != 0) return NINGUNO;
+                grupo = (grupo + paso) & (this->grupos - 1);
+            }
+        }
+
+        // La marca no está en la tabla y hay lugar
+        void colocar(size_t hash, uint32_t id) {
+            size_t grupo = this->grupoInicial(hash);
+            for (size_t paso = 1;; paso++) {
+                uint32_t libres = this->disponibles(grupo);
+                if (libres != 0) {
+                    size_t casilla = grupo * TAMANIO_GRUPO + __builtin_ctz(libres);
+                    if (this->etiquetas[casilla] == BORRADA) this->borradas--;
+                    this->etiquetas[casilla] = etiquetaDe(hash);
+                    this->ids[casilla] = id;
+                    this->ocupadas++;
+                    return;
+                }
+                grupo = (grupo + paso) & (this->grupos - 1);
+            }
+        }
+
+        /**
+         * Si el grupo ya tiene una casilla vacía, ninguna búsqueda pasó de largo
+         * por él y la casilla puede quedar vacía. Si no, se marca como borrada
+         * para que las búsquedas sigan al grupo siguiente.
+         */
+        void liberar(size_t casilla) {
+            size_t grupo = casilla / TAMANIO_GRUPO;
+            if (this->coincidencias(grupo, VACIA) != 0) {
+                this->etiquetas[casilla] = VACIA;
+            } else {
+                this->etiquetas[casilla] = BORRADA;
+                this->borradas++;
+            }
+            this->ocupadas--;
+        }
+
+        // Reconstruye la tabla con 'grupos' grupos, descartando las casillas borradas
+        void rehacer(size_t grupos) {
+            vector<uint8_t> etiquetasViejas(grupos * TAMANIO_GRUPO, VACIA);
+            vector<uint32_t> idsViejos(grupos * TAMANIO_GRUPO, NINGUNO);
+            swap(etiquetasViejas, this->etiquetas);
+            swap(idsViejos, this->ids);
+            this->grupos = grupos;
+            this->ocupadas = 0;
+            this->borradas = 0;
+            for (size_t i = 0; i < etiquetasViejas.size(); i++) {
+                if (etiquetasViejas[i] & 0x80) continue;
+                this->colocar(this->hashDe(this->autos.marca(idsViejos[i])), idsViejos[i]);
+            }
+        }
+};
+
+#endif
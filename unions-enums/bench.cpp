@@ -0,0 +1,159 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <set>
+#include <variant>
+#include <vector>
+#include "valores.h"
+#include "horarios.h"
+
+using namespace std;
+
+template <typename Funcion>
+double medirMs(Funcion f) {
+    auto inicio = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+/**
+ * vector<variant<int, char, double>> contra ColumnaValores con la misma
+ * mezcla de valores: 50% int, 30% char y 20% double, en orden aleatorio.
+ */
+void benchColumna() {
+    const size_t N = 30000000, ACCESOS = 10000000;
+
+    mt19937 aleatorio(11);
+    vector<variant<int, char, double>> variantes;
+    ColumnaValores columna;
+    double crearVariantes = 0, crearColumna = 0;
+    {
+        vector<Valor> valores;
+        valores.reserve(N);
+        for (size_t i = 0; i < N; i++) {
+            unsigned r = aleatorio() % 10;
+            if (r < 5) valores.push_back(Valor(int(aleatorio() % 1000)));
+            else if (r < 8) valores.push_back(Valor(char('a' + r)));
+            else valores.push_back(Valor(double(aleatorio() % 1000) / 8));
+        }
+        crearVariantes = medirMs([&]() {
+            variantes.reserve(N);
+            for (const Valor &v : valores) v.visitar([&](auto x) { variantes.emplace_back(x); });
+        });
+        crearColumna = medirMs([&]() {
+            columna.reservar(N);
+            for (const Valor &v : valores) columna.agregar(v);
+        });
+    }
+
+    // Suma de todos los int
+    long long sumaVariantes = 0, sumaColumna = 0;
+    double sumarVariantes = medirMs([&]() {
+        for (const auto &v : variantes) if (const int *n = get_if<int>(&v)) sumaVariantes += *n;
+    });
+    double sumarColumna = medirMs([&]() {
+        for (int n : columna.getNumeros()) sumaColumna += n;
+    });
+
+    // Filas que guardan un char
+    vector<uint32_t> filasVariantes, filasColumna;
+    double filtrarVariantes = medirMs([&]() {
+        for (size_t i = 0; i < variantes.size(); i++) if (variantes[i].index() == 1) filasVariantes.push_back(i);
+    });
+    double filtrarColumna = medirMs([&]() {
+        filasColumna = columna.filtrar(TipoValor::LETRA);
+    });
+
+    // Lectura de filas sueltas en orden aleatorio
+    vector<uint32_t> filas(ACCESOS);
+    for (uint32_t &f : filas) f = aleatorio() % N;
+    double totalVariantes = 0, totalColumna = 0;
+    double accesoVariantes = medirMs([&]() {
+        for (uint32_t f : filas) visit([&](auto x) { totalVariantes += x; }, variantes[f]);
+    });
+    double accesoColumna = medirMs([&]() {
+        for (uint32_t f : filas) columna[f].visitar([&](auto x) { totalColumna += x; });
+    });
+
+    cout << N << " valores\t\tvariant\t\tColumnaValores" << endl;
+    cout << "sizeof\t\t\t\t" << sizeof(variantes[0]) << "\t\t" << sizeof(Valor) << " (Valor)" << endl;
+    cout << "Memoria (MiB)\t\t\t" << variantes.size() * sizeof(variantes[0]) / 1048576 << "\t\t" << columna.bytes() / 1048576 << endl;
+    cout << "Crear (ms)\t\t\t" << crearVariantes << "\t\t" << crearColumna << endl;
+    cout << "Sumar los int (ms)\t\t" << sumarVariantes << "\t\t" << sumarColumna << (sumaVariantes == sumaColumna ? "" : "  (!)") << endl;
+    cout << "Filtrar los char (ms)\t\t" << filtrarVariantes << "\t\t" << filtrarColumna << (filasVariantes == filasColumna ? "" : "  (!)") << endl;
+    cout << "Fila aleatoria (ns)\t\t" << accesoVariantes * 1e6 / ACCESOS << "\t\t" << accesoColumna * 1e6 / ACCESOS
+         << (totalVariantes == totalColumna ? "" : "  (!)") << endl;
+}
+
+/**
+ * Agenda de 5 millones de entidades: vector<set<dias_semana>> contra
+ * AgendaSemanal (un byte por entidad y un bitmap por día).
+ */
+void benchAgenda() {
+    const size_t N = 5000000;
+
+    mt19937 aleatorio(5);
+    vector<Dias> dias(N);
+    for (Dias &d : dias) d = aleatorio() & TODA_LA_SEMANA;
+
+    vector<set<dias_semana>> conjuntos;
+    AgendaSemanal agenda;
+    double crearConjuntos = medirMs([&]() {
+        conjuntos.resize(N);
+        for (size_t i = 0; i < N; i++) {
+            for (size_t d = 0; d < DIAS_SEMANA; d++) if (dias[i] >> d & 1) conjuntos[i].insert(dias_semana(d));
+        }
+    });
+    double crearAgenda = medirMs([&]() {
+        agenda.reservar(N);
+        for (Dias d : dias) agenda.agregar(d);
+    });
+
+    struct Caso {
+        const char *nombre;
+        ConsultaDias consulta;
+        bool (*conjunto)(const set<dias_semana> &);
+    };
+    Caso casos[] = {
+        { "lunes y miércoles", { diasEnBits({ lunes, miercoles }), 0, 0 },
+          [](const set<dias_semana> &s) { return s.count(lunes) && s.count(miercoles); } },
+        { "fin de semana, no viernes", { 0, diasEnBits({ sabado, domingo }), diaEnBits(viernes) },
+          [](const set<dias_semana> &s) { return (s.count(sabado) || s.count(domingo)) && !s.count(viernes); } },
+        { "lunes a viernes", { diasEnBits({ lunes, martes, miercoles, jueves, viernes }), 0, 0 },
+          [](const set<dias_semana> &s) { return s.count(lunes) && s.count(martes) && s.count(miercoles) && s.count(jueves) && s.count(viernes); } },
+    };
+
+    cout << "Agenda de " << N << " entidades\t\tset\t\tbytes (SIMD)\tbitmaps (SIMD)" << endl;
+    cout << "Crear (ms)\t\t\t\t" << crearConjuntos << "\t\t" << crearAgenda << endl;
+    for (const Caso &caso : casos) {
+        size_t enConjuntos = 0, recorriendo = 0, enBitmaps = 0;
+        double msConjuntos = medirMs([&]() {
+            for (const set<dias_semana> &s : conjuntos) enConjuntos += caso.conjunto(s);
+        });
+        double msRecorriendo = medirMs([&]() { recorriendo = agenda.contarRecorriendo(caso.consulta); });
+        double msBitmaps = medirMs([&]() { enBitmaps = agenda.contar(caso.consulta); });
+        cout << caso.nombre << " (ms)\t\t" << (strlen(caso.nombre) < 18 ? "\t" : "") << msConjuntos << "\t\t" << msRecorriendo
+             << "\t\t" << msBitmaps << (enConjuntos == recorriendo && recorriendo == enBitmaps ? "" : "  (!)") << endl;
+    }
+    size_t lunesConjuntos = 0;
+    double msLunes = medirMs([&]() {
+        for (const set<dias_semana> &s : conjuntos) lunesConjuntos += s.count(lunes);
+    });
+    cout << "Solo lunes (ms)\t\t\t\t" << msLunes << "\t\tO(1): " << agenda.contarDia(lunes)
+         << (lunesConjuntos == agenda.contarDia(lunes) ? "" : "  (!)") << endl;
+
+    // Cada set vacío ocupa su encabezado; cada día, un nodo de árbol (~40 bytes más lo que agrega malloc)
+    size_t nodos = 0;
+    for (const set<dias_semana> &s : conjuntos) nodos += s.size();
+    cout << "Memoria (MiB)\t\t\t\t~" << (N * sizeof(set<dias_semana>) + nodos * 48) / 1048576 << "\t\t" << agenda.bytes() / 1048576 << endl;
+}
+
+int main() {
+
+    benchColumna();
+    cout << endl;
+    benchAgenda();
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Días de la semana como conjuntos de bits.
+ *
+ * Un enum sin valores asignados numera sus elementos desde 0, así que cada día
+ * puede ser un bit de un byte: {lunes, miércoles} es 0b0000101. Unir, cruzar y
+ * comparar conjuntos de días son operaciones de bits (|, &, ~), sin nodos ni
+ * memoria dinámica como un std::set<dias_semana>.
+ */
+#ifndef HORARIOS_H
+#define HORARIOS_H
+
+enum dias_semana { lunes, martes, miercoles, jueves, viernes, sabado, domingo };
+
+constexpr size_t DIAS_SEMANA = 7;
+
+// Un bit por día: bit 0 = lunes ... bit 6 = domingo
+typedef uint8_t Dias;
+
+constexpr Dias TODA_LA_SEMANA = (1 << DIAS_SEMANA) - 1;
+
+constexpr Dias diaEnBits(dias_semana dia) {
+    return Dias(1 << dia);
+}
+constexpr Dias diasEnBits(initializer_list<dias_semana> dias) {
+    Dias bits = 0;
+    for (dias_semana d : dias) bits |= diaEnBits(d);
+    return bits;
+}
+
+/**
+ * Tabla de nombres en el mismo orden que el enum; al ser constexpr, las
+ * conversiones en ambos sentidos pueden resolverse al compilar.
+ */
+constexpr string_view NOMBRES_DIAS[DIAS_SEMANA] = { "lunes", "martes", "miercoles", "jueves", "viernes", "sabado", "domingo" };
+
+constexpr string_view nombreDia(dias_semana dia) {
+    return NOMBRES_DIAS[dia];
+}
+constexpr dias_semana diaDesdeNombre(string_view nombre) {
+    for (size_t d = 0; d < DIAS_SEMANA; d++) {
+        if (NOMBRES_DIAS[d] == nombre) return dias_semana(d);
+    }
+    throw invalid_argument("Día desconocido");
+}
+
+static_assert(diaDesdeNombre("miercoles") == miercoles, "Tabla de nombres fuera de orden");
+static_assert(nombreDia(domingo) == "domingo", "Tabla de nombres fuera de orden");
+static_assert(diasEnBits({ lunes, miercoles }) == 0b101, "Un bit por día");
+
+/**
+ * Consulta sobre los días de cada entidad: debe estar disponible en todos los
+ * días de 'todos', en al menos uno de 'alguno' (si no está vacío) y en
+ * ninguno de 'ninguno'.
+ */
+struct ConsultaDias {
+    Dias todos = 0;
+    Dias alguno = 0;
+    Dias ninguno = 0;
+
+    constexpr bool cumple(Dias dias) const {
+        return (dias & todos) == todos && (alguno == 0 || (dias & alguno) != 0) && (dias & ninguno) == 0;
+    }
+};
+
+/**
+ * Agenda semanal de millones de entidades, guardada de dos formas:
+ *
+ *   dias          [Dias | Dias | ...]      1 byte por entidad
+ *   publicaciones lunes   [0110 1001 ...]  1 bit por entidad, por cada día
+ *                 martes  [1100 0011 ...]
+ *                 ...
+ *
+ * Las listas de publicación (posting lists, como en los índices de los
+ * buscadores) responden "¿quiénes están el lunes y el miércoles?" con un AND
+ * de dos bitmaps: 128 entidades por instrucción SSE2. El conteo de cada día
+ * se mantiene al agregar y cambiar, así que consultar un solo día es O(1).
+ */
+class AgendaSemanal {
+    public:
+        uint32_t agregar(Dias dias) {
+            uint32_t id = this->dias.size();
+            if (id % BITS_POR_BLOQUE == 0) {
+                for (vector<uint64_t> &p : this->publicaciones) p.resize(p.size() + PALABRAS_POR_BLOQUE, 0);
+                this->existentes.resize(this->existentes.size() + PALABRAS_POR_BLOQUE, 0);
+            }
+            this->existentes[id / 64] |= uint64_t(1) << (id % 64);
+            this->dias.push_back(0);
+            this->cambiar(id, dias);
+            return id;
+        }
+        uint32_t agregar(initializer_list<dias_semana> dias) {
+            return this->agregar(diasEnBits(dias));
+        }
+        void cambiar(uint32_t id, Dias dias) {
+            dias &= TODA_LA_SEMANA;
+            // Solo cambian las listas de los días que se encienden o se apagan
+            Dias cambios = this->dias.at(id) ^ dias;
+            for (unsigned c = cambios; c != 0; c &= c - 1) {
+                unsigned d = __builtin_ctz(c);
+                this->publicaciones[d][id / 64] ^= uint64_t(1) << (id % 64);
+                if (dias >> d & 1) this->conteos[d]++;
+                else this->conteos[d]--;
+            }
+            this->dias[id] = dias;
+        }
+        void reservar(size_t entidades) {
+            this->dias.reserve(entidades);
+            for (vector<uint64_t> &p : this->publicaciones) p.reserve(entidades / 64 + PALABRAS_POR_BLOQUE);
+            this->existentes.reserve(entidades / 64 + PALABRAS_POR_BLOQUE);
+        }
+
+        Dias diasDe(uint32_t id) const {
+            return this->dias[id];
+        }
+        size_t contarDia(dias_semana dia) const {
+            return this->conteos[dia];
+        }
+
+        /**
+         * Combina las listas de publicación palabra por palabra: AND de las de
+         * 'todos', OR de las de 'alguno' y AND NOT de las de 'ninguno'. Llama a
+         * f(bloque, resultado) con cada bloque de 128 entidades.
+         */
+        template <typename Funcion>
+        void evaluar(const ConsultaDias &consulta, Funcion f) const {
+            size_t palabras = this->existentes.size();
+            const uint64_t *todos[DIAS_SEMANA], *alguno[DIAS_SEMANA], *ninguno[DIAS_SEMANA];
+            size_t nTodos = 0, nAlguno = 0, nNinguno = 0;
+            for (size_t d = 0; d < DIAS_SEMANA; d++) {
+                if (consulta.todos >> d & 1) todos[nTodos++] = this->publicaciones[d].data();
+                if (consulta.alguno >> d & 1) alguno[nAlguno++] = this->publicaciones[d].data();
+                if (consulta.ninguno >> d & 1) ninguno[nNinguno++] = this->publicaciones[d].data();
+            }
+            // Se parte de las entidades existentes: los bits de relleno quedan en 0
+            const uint64_t *vivas = this->existentes.data();
+            for (size_t w = 0; w < palabras; w += PALABRAS_POR_BLOQUE) {
+#if defined(__SSE2__)
+                __m128i r = cargar(vivas + w);
+                for (size_t i = 0; i < nTodos; i++) r = _mm_and_si128(r, cargar(todos[i] + w));
+                if (nAlguno > 0) {
+                    __m128i o = _mm_setzero_si128();
+                    for (size_t i = 0; i < nAlguno; i++) o = _mm_or_si128(o, cargar(alguno[i] + w));
+                    r = _mm_and_si128(r, o);
+                }
+                for (size_t i = 0; i < nNinguno; i++) r = _mm_andnot_si128(cargar(ninguno[i] + w), r);
+                alignas(16) uint64_t bloque[PALABRAS_POR_BLOQUE];
+                _mm_store_si128(reinterpret_cast<__m128i *>(bloque), r);
+#else
+                uint64_t bloque[PALABRAS_POR_BLOQUE];
+                for (size_t k = 0; k < PALABRAS_POR_BLOQUE; k++) {
+                    uint64_t r = vivas[w + k], o = nAlguno > 0 ? 0 : ~uint64_t(0);
+                    for (size_t i = 0; i < nTodos; i++) r &= todos[i][w + k];
+                    for (size_t i = 0; i < nAlguno; i++) o |= alguno[i][w + k];
+                    for (size_t i = 0; i < nNinguno; i++) r &= ~ninguno[i][w + k];
+                    bloque[k] = r & o;
+                }
+#endif
+                f(w / PALABRAS_POR_BLOQUE, bloque);
+            }
+        }
+        size_t contar(const ConsultaDias &consulta) const {
+            size_t total = 0;
+            this->evaluar(consulta, [&total](size_t, const uint64_t *bloque) {
+                for (size_t k = 0; k < PALABRAS_POR_BLOQUE; k++) total += __builtin_popcountll(bloque[k]);
+            });
+            return total;
+        }
+        vector<uint32_t> filtrar(const ConsultaDias &consulta) const {
+            vector<uint32_t> ids;
+            this->evaluar(consulta, [&ids](size_t b, const uint64_t *bloque) {
+                for (size_t k = 0; k < PALABRAS_POR_BLOQUE; k++) {
+                    for (uint64_t m = bloque[k]; m != 0; m &= m - 1) {
+                        ids.push_back(uint32_t(b * BITS_POR_BLOQUE + k * 64 + __builtin_ctzll(m)));
+                    }
+                }
+            });
+            return ids;
+        }
+
+        /**
+         * La misma consulta sobre el arreglo de un byte por entidad, 16
+         * entidades por instrucción. Útil cuando además de los días se revisan
+         * otros datos de cada entidad en el mismo recorrido.
+         */
+        size_t contarRecorriendo(const ConsultaDias &consulta) const {
+            size_t total = 0, i = 0, n = this->dias.size();
+#if defined(__SSE2__)
+            __m128i todos = _mm_set1_epi8(char(consulta.todos)), alguno = _mm_set1_epi8(char(consulta.alguno));
+            __m128i ninguno = _mm_set1_epi8(char(consulta.ninguno)), cero = _mm_setzero_si128();
+            for (; i + 16 <= n; i += 16) {
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&this->dias[i]));
+                __m128i ok = _mm_cmpeq_epi8(_mm_and_si128(d, todos), todos);
+                ok = _mm_and_si128(ok, _mm_cmpeq_epi8(_mm_and_si128(d, ninguno), cero));
+                unsigned m = _mm_movemask_epi8(ok);
+                // Con 'alguno' vacío la condición se cumple siempre
+                if (consulta.alguno != 0) m &= ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(d, alguno), cero));
+                total += __builtin_popcount(m);
+            }
+#endif
+            for (; i < n; i++) total += consulta.cumple(this->dias[i]);
+            return total;
+        }
+
+        size_t size() const {
+            return this->dias.size();
+        }
+        size_t bytes() const {
+            return this->dias.size() + (DIAS_SEMANA + 1) * this->existentes.size() * sizeof(uint64_t);
+        }
+    private:
+        // Las listas crecen de 128 en 128 entidades (un registro SSE2)
+        static constexpr size_t PALABRAS_POR_BLOQUE = 2;
+        static constexpr size_t BITS_POR_BLOQUE = 64 * PALABRAS_POR_BLOQUE;
+
+        vector<Dias> dias;
+        vector<uint64_t> publicaciones[DIAS_SEMANA];
+        // Un bit por entidad agregada
+        vector<uint64_t> existentes;
+        size_t conteos[DIAS_SEMANA] = {};
+
+#if defined(__SSE2__)
+        static __m128i cargar(const uint64_t *p) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        }
+#endif
+};
+
+#endif
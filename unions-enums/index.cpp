@@ -1,4 +1,13 @@
 #include <iostream>
+/**
+ * Valores etiquetados (int, char o double) y columnas de muchos valores.
+ */
+#include "valores.h"
+/**
+ * La enumeración dias_semana está definida en horarios.h, junto con la agenda
+ * que guarda los días de cada entidad como bits.
+ */
+#include "horarios.h"
 
 using namespace std;
 
@@ -39,6 +48,26 @@ int main() {
     // O bien casteando el tipo int hacia un char:
     cout << "(union) Valor como int casteado a char: " << (char) variable.numero << endl;
 
+    /**
+     * La unión no guarda cuál de sus miembros se asignó. Valor sí lo recuerda,
+     * sin ocupar más que un double (8 bytes), y leerlo con el tipo equivocado
+     * lanza una excepción.
+     */
+    Valor etiquetado = 'W';
+    cout << "(Valor) Tipo: " << nombreTipo(etiquetado.tipo()) << ", valor: " << etiquetado << endl;
+    try {
+        cout << etiquetado.numero() << endl;
+    } catch (const runtime_error &e) {
+        cout << "(Valor) " << e.what() << endl;
+    }
+
+    // Muchos valores: etiquetas en un arreglo de bytes y cada tipo en su propio vector
+    ColumnaValores columna;
+    for (Valor v : { Valor(7), Valor('x'), Valor(3.5), Valor(-2), Valor('y') }) columna.agregar(v);
+    cout << "(ColumnaValores) Fila 3: " << columna[3] << ", letras en las filas:";
+    for (uint32_t fila : columna.filtrar(TipoValor::LETRA)) cout << " " << fila;
+    cout << endl;
+
     cout << endl;
 
     /**
@@ -52,16 +81,30 @@ int main() {
      * de reservar más memoria mas que la usada por la enumeración.
      * 
      * La siguiente enumeración utiliza por defecto números (comenzando por el 0)
-     * al no tener un valor asignado directamente a cada elemento.
+     * al no tener un valor asignado directamente a cada elemento:
+     *
+     * enum dias_semana { lunes, martes, miercoles, jueves, viernes, sabado, domingo };
      */
-    enum dias_semana { lunes, martes, miercoles, jueves };
-    
     dias_semana ayer = martes;
     dias_semana hoy = miercoles;
 
     cout << "(enum) Valor de ayer: " << ayer << endl; // 1
     cout << "(enum) Valor de ayer + 1: " << ayer + 1 << endl; // 2
     cout << "(enum) Valor de hoy: " << hoy << endl; // 2
+    cout << "(enum) Nombre de hoy: " << nombreDia(hoy) << endl;
+
+    /**
+     * Como cada día es un número del 0 al 6, también puede ser un bit: un
+     * conjunto de días cabe en un byte.
+     */
+    AgendaSemanal agenda;
+    agenda.agregar({ lunes, miercoles, viernes });
+    agenda.agregar({ lunes, martes });
+    agenda.agregar({ sabado, domingo });
+    ConsultaDias lunesYMiercoles;
+    lunesYMiercoles.todos = diasEnBits({ lunes, miercoles });
+    cout << "(enum) Disponibles lunes y miércoles: " << agenda.contar(lunesYMiercoles) << endl;
+    cout << "(enum) Disponibles el " << nombreDia(diaDesdeNombre("lunes")) << ": " << agenda.contarDia(lunes) << endl;
 
     cout << endl;
 
@@ -0,0 +1,258 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * Valores etiquetados: int, char o double.
+ *
+ * Una unión como caracter_alfanumerico no recuerda qué miembro se guardó, y
+ * leer el otro es comportamiento indefinido. Guardar la etiqueta junto al
+ * valor (como std::variant) lo hace seguro, pero un variant<int, char, double>
+ * ocupa 16 bytes: 8 del double más la etiqueta, redondeado por la alineación.
+ */
+#ifndef VALORES_H
+#define VALORES_H
+
+enum class TipoValor : uint8_t { NUMERO = 0, LETRA = 1, REAL = 2 };
+
+constexpr size_t TIPOS_VALOR = 3;
+
+inline const char *nombreTipo(TipoValor tipo) {
+    switch (tipo) {
+        case TipoValor::NUMERO: return "int";
+        case TipoValor::LETRA: return "char";
+        case TipoValor::REAL: return "double";
+    }
+    return "?";
+}
+
+/**
+ * Valor de 8 bytes con "NaN-boxing": un double usa los 64 bits tal cual, y un
+ * int o un char se guardan dentro de un NaN, un patrón de bits que ningún
+ * cálculo produce porque todos los NaN reales se normalizan al guardarlos:
+ *
+ *   double   cualquier patrón menor a 0xFFF9 0000 0000 0000
+ *   int      0xFFF9 0000 | 32 bits del número
+ *   char     0xFFFA 0000 0000 00 | 8 bits de la letra
+ */
+class Valor {
+    public:
+        Valor(int numero) {
+            this->bits = PREFIJO_NUMERO | uint32_t(numero);
+        }
+        Valor(char letra) {
+            this->bits = PREFIJO_LETRA | uint8_t(letra);
+        }
+        Valor(double real) {
+            // Todos los NaN se guardan como el NaN estándar para no confundirse con un int o un char
+            if (isnan(real)) real = numeric_limits<double>::quiet_NaN();
+            memcpy(&this->bits, &real, sizeof(real));
+        }
+
+        TipoValor tipo() const {
+            if (this->bits < PREFIJO_NUMERO) return TipoValor::REAL;
+            return (this->bits >> 48) == (PREFIJO_NUMERO >> 48) ? TipoValor::NUMERO : TipoValor::LETRA;
+        }
+        bool es(TipoValor tipo) const {
+            return this->tipo() == tipo;
+        }
+
+        // Leer con el tipo equivocado lanza una excepción en lugar de reinterpretar bits
+        int numero() const {
+            this->exigir(TipoValor::NUMERO);
+            return int(uint32_t(this->bits));
+        }
+        char letra() const {
+            this->exigir(TipoValor::LETRA);
+            return char(uint8_t(this->bits));
+        }
+        double real() const {
+            this->exigir(TipoValor::REAL);
+            double r;
+            memcpy(&r, &this->bits, sizeof(r));
+            return r;
+        }
+
+        // Llama a f con el valor en su tipo real (int, char o double)
+        template <typename Funcion>
+        auto visitar(Funcion f) const {
+            switch (this->tipo()) {
+                case TipoValor::NUMERO: return f(this->numero());
+                case TipoValor::LETRA: return f(this->letra());
+                default: return f(this->real());
+            }
+        }
+    private:
+        static constexpr uint64_t PREFIJO_NUMERO = uint64_t(0xFFF9) << 48;
+        static constexpr uint64_t PREFIJO_LETRA = uint64_t(0xFFFA) << 48;
+
+        uint64_t bits;
+
+        void exigir(TipoValor tipo) const {
+            if (this->tipo() != tipo) {
+                throw runtime_error(string("El valor es ") + nombreTipo(this->tipo()) + ", no " + nombreTipo(tipo));
+            }
+        }
+};
+
+static_assert(sizeof(Valor) == 8, "Valor debe ocupar 8 bytes");
+
+inline ostream &operator<<(ostream &salida, const Valor &v) {
+    v.visitar([&salida](auto x) { salida << x; });
+    return salida;
+}
+
+/**
+ * Columna de valores heterogéneos en formato columnar:
+ *
+ *   etiquetas [NUMERO | LETRA | NUMERO | REAL | ...]   1 byte por fila
+ *   numeros   [int | int | ...]                        solo las filas int
+ *   letras    [char | ...]                             solo las filas char
+ *   reales    [double | ...]                           solo las filas double
+ *
+ * Cada valor ocupa su tamaño real más 1.33 bytes de etiqueta y conteos (un
+ * char ocupa 2.33 bytes en lugar de 16), y sumar todos los int es recorrer
+ * un vector<int>.
+ * Filtrar por tipo compara 16 etiquetas por instrucción (SSE2).
+ *
+ * Para leer la fila i hace falta su posición en la subcolumna de su tipo
+ * (cuántas filas anteriores tienen ese tipo). Las etiquetas se agrupan en
+ * bloques de 48 filas que ocupan una línea de caché de 64 bytes junto con ese
+ * conteo al inicio del bloque; dentro del bloque se cuenta con SIMD. Así leer
+ * una fila cuesta dos accesos a memoria: el bloque y la subcolumna.
+ *
+ * La columna solo crece al final: cambiar el tipo de una fila intermedia
+ * obligaría a recorrer las subcolumnas.
+ */
+class ColumnaValores {
+    public:
+        static constexpr size_t FILAS_POR_BLOQUE = 48;
+
+        void agregar(Valor v) {
+            size_t fila = this->filas;
+            if (fila % FILAS_POR_BLOQUE == 0) {
+                // Bloque nuevo: su conteo inicial y sus etiquetas de relleno
+                Bloque bloque;
+                bloque.conteos[size_t(TipoValor::NUMERO)] = this->numeros.size();
+                bloque.conteos[size_t(TipoValor::LETRA)] = this->letras.size();
+                bloque.conteos[size_t(TipoValor::REAL)] = this->reales.size();
+                bloque.relleno = 0;
+                memset(bloque.etiquetas, SIN_FILA, sizeof(bloque.etiquetas));
+                this->bloques.push_back(bloque);
+            }
+            TipoValor tipo = v.tipo();
+            this->bloques.back().etiquetas[fila % FILAS_POR_BLOQUE] = uint8_t(tipo);
+            switch (tipo) {
+                case TipoValor::NUMERO: this->numeros.push_back(v.numero()); break;
+                case TipoValor::LETRA: this->letras.push_back(v.letra()); break;
+                case TipoValor::REAL: this->reales.push_back(v.real()); break;
+            }
+            this->filas++;
+        }
+        void reservar(size_t filas) {
+            this->bloques.reserve(filas / FILAS_POR_BLOQUE + 1);
+        }
+
+        TipoValor tipo(size_t fila) const {
+            return TipoValor(this->bloques[fila / FILAS_POR_BLOQUE].etiquetas[fila % FILAS_POR_BLOQUE]);
+        }
+        Valor operator[](size_t fila) const {
+            const Bloque &bloque = this->bloques[fila / FILAS_POR_BLOQUE];
+            size_t dentro = fila % FILAS_POR_BLOQUE;
+            TipoValor t = TipoValor(bloque.etiquetas[dentro]);
+            uint64_t anteriores = mascara(bloque, t) & ((uint64_t(1) << dentro) - 1);
+            size_t posicion = bloque.conteos[size_t(t)] + __builtin_popcountll(anteriores);
+            switch (t) {
+                case TipoValor::NUMERO: return Valor(this->numeros[posicion]);
+                case TipoValor::LETRA: return Valor(this->letras[posicion]);
+                default: return Valor(this->reales[posicion]);
+            }
+        }
+        Valor at(size_t fila) const {
+            if (fila >= this->filas) throw out_of_range("Fila fuera de la columna");
+            return (*this)[fila];
+        }
+
+        // Filas con el tipo indicado, en orden
+        vector<uint32_t> filtrar(TipoValor tipo) const {
+            vector<uint32_t> resultado;
+            resultado.reserve(this->contar(tipo));
+            for (size_t b = 0; b < this->bloques.size(); b++) {
+                for (uint64_t m = mascara(this->bloques[b], tipo); m != 0; m &= m - 1) {
+                    resultado.push_back(uint32_t(b * FILAS_POR_BLOQUE + __builtin_ctzll(m)));
+                }
+            }
+            return resultado;
+        }
+        size_t contar(TipoValor tipo) const {
+            switch (tipo) {
+                case TipoValor::NUMERO: return this->numeros.size();
+                case TipoValor::LETRA: return this->letras.size();
+                default: return this->reales.size();
+            }
+        }
+
+        // Subcolumnas: recorrer valores de un solo tipo sin revisar etiquetas
+        const vector<int> &getNumeros() const {
+            return this->numeros;
+        }
+        const vector<char> &getLetras() const {
+            return this->letras;
+        }
+        const vector<double> &getReales() const {
+            return this->reales;
+        }
+
+        size_t size() const {
+            return this->filas;
+        }
+        size_t bytes() const {
+            return this->bloques.size() * sizeof(Bloque) + this->numeros.size() * sizeof(int) +
+                   this->letras.size() * sizeof(char) + this->reales.size() * sizeof(double);
+        }
+    private:
+        // Etiqueta de las filas de relleno al final del último bloque
+        static constexpr uint8_t SIN_FILA = 0xFF;
+
+        struct alignas(64) Bloque {
+            // Filas de cada tipo antes de este bloque
+            uint32_t conteos[TIPOS_VALOR];
+            uint32_t relleno;
+            uint8_t etiquetas[FILAS_POR_BLOQUE];
+        };
+        static_assert(sizeof(Bloque) == 64, "Un bloque ocupa una línea de caché");
+
+        size_t filas = 0;
+        vector<Bloque> bloques;
+        vector<int> numeros;
+        vector<char> letras;
+        vector<double> reales;
+
+        // Bit i encendido si la fila i del bloque tiene el tipo indicado
+        static uint64_t mascara(const Bloque &bloque, TipoValor tipo) {
+#if defined(__SSE2__)
+            __m128i buscado = _mm_set1_epi8(char(tipo));
+            uint64_t m = 0;
+            for (size_t i = 0; i < FILAS_POR_BLOQUE; i += 16) {
+                __m128i grupo = _mm_load_si128(reinterpret_cast<const __m128i *>(bloque.etiquetas + i));
+                m |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(grupo, buscado)))) << i;
+            }
+            return m;
+#else
+            uint64_t m = 0;
+            for (size_t i = 0; i < FILAS_POR_BLOQUE; i++) m |= uint64_t(bloque.etiquetas[i] == uint8_t(tipo)) << i;
+            return m;
+#endif
+        }
+};
+
+#endif